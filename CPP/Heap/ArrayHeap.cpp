@@ -9,282 +9,453 @@
  *   $DateTime: 2011/01/28 17:41:51 $   
  */
 
+#include <algorithm>
 #include "ArrayHeap.hpp"
 
 /**************************************
-         ArrayNode MEMBER FUNCTIONS
+				 ArrayHeap MEMBER FUNCTIONS
 		 **************************************/
 
-// CONSTRUCTOR: ArrayNode's ind variable will record each node's position in the array
-template<typename dataType>
-ArrayHeap<dataType>::ArrayNode::ArrayNode( const dataType& e, typename Heap<dataType>::compareFxn& f,
-													                 typename Heap<dataType>::order& o, int ind )
-												        : Heap<dataType>::Handle( f, o, e )
-{ index = ind ; }
-
-// ASSIGNMENT OVERLOAD: must copy the ind variable
-template<typename dataType>
-typename ArrayHeap<dataType>::ArrayNode&  ArrayHeap<dataType>::ArrayNode::operator=( const ArrayNode& a )
+// CONSTRUCTOR: create the first block and the array
+template<typename dataType, int arity, typename Priority, typename Hooks>
+ArrayHeap<dataType, arity, Priority, Hooks>::ArrayHeap( typename Heap<dataType>::compareFxn f, typename Heap<dataType>::order o, int size )
+                     : priority( f, o ), max_size( 0 ), array( 0 )
 {
-	index = a.index ;
-	return *this ;
+	grow( size > 0 ? size : 1 );
+	hooks.created( "ArrayHeap", Base::size() );
 }
 
-/**************************************
-				 ArrayHeap MEMBER FUNCTIONS
-		 **************************************/
+// CONSTRUCTOR: same, with the Priority object given directly
+template<typename dataType, int arity, typename Priority, typename Hooks>
+ArrayHeap<dataType, arity, Priority, Hooks>::ArrayHeap( const Priority& p, int size )
+                     : priority( p ), max_size( 0 ), array( 0 )
+{
+	grow( size > 0 ? size : 1 );
+	hooks.created( "ArrayHeap", Base::size() );
+}
 
-// CONSTRUCTOR: create the array and store its size
-template<typename dataType>
-ArrayHeap<dataType>::ArrayHeap( typename Heap<dataType>::compareFxn f, typename Heap<dataType>::order o, int size )
-                     : Heap<dataType>( f, o )
+// CONSTRUCTOR: build the heap from all the elements of a vector, in O(n)
+template<typename dataType, int arity, typename Priority, typename Hooks>
+ArrayHeap<dataType, arity, Priority, Hooks>::ArrayHeap( const std::vector<dataType>& v, const Priority& p )
+                     : priority( p ), max_size( 0 ), array( 0 )
 {
-	array = new ArrayNode*[ size ];
-	max_size = size ;
-  cout << "Create an ArrayHeap.\n" << endl;
+	grow( v.size() > 0 ? v.size() : 1 );
+	for( unsigned int i = 0 ; i < v.size() ; i++ )
+	  append( v[i] );
+	heapify();
+	hooks.created( "ArrayHeap", Base::size() );
 }
 
 // COPY CONSTRUCTOR: create a new copy of the each array element
-template<typename dataType>
-ArrayHeap<dataType>::ArrayHeap( const ArrayHeap<dataType>& H ) : Heap<dataType>(H)
+template<typename dataType, int arity, typename Priority, typename Hooks>
+ArrayHeap<dataType, arity, Priority, Hooks>::ArrayHeap( const ArrayHeap<dataType, arity, Priority, Hooks>& H )
+                     : Base( H ), priority( H.priority ), hooks( H.hooks ), max_size( 0 ), array( 0 )
+{
+	copy( H );
+	hooks.created( "ArrayHeap", Base::size() );
+}
+
+// DESTRUCTOR: have to destroy the nodes as they were constructed in place
+template<typename dataType, int arity, typename Priority, typename Hooks>
+ArrayHeap<dataType, arity, Priority, Hooks>::~ArrayHeap()
+{
+	hooks.destroyed( "ArrayHeap", Base::size() );
+	release();
+}
+
+// ASSIGNMENT OVERLOAD: destroy the old array and copy the newly-assigned one
+template<typename dataType, int arity, typename Priority, typename Hooks>
+ArrayHeap<dataType, arity, Priority, Hooks>& ArrayHeap<dataType, arity, Priority, Hooks>::operator=( const ArrayHeap<dataType, arity, Priority, Hooks>& H )
+{
+	if( this == &H )
+	  return *this ;
+
+	release();
+	Base::operator=( H );
+	priority = H.priority ;
+	hooks = H.hooks ;
+	copy( H );
+
+	return *this;
+}
+
+// copy(): duplicate the nodes of H position by position, ids included
+//   H is already a heap, so nothing has to be sifted -- O(n)
+template<typename dataType, int arity, typename Priority, typename Hooks>
+void ArrayHeap<dataType, arity, Priority, Hooks>::copy( const ArrayHeap<dataType, arity, Priority, Hooks>& H )
 {
-	array = new ArrayNode*[ H.max_size ];
+	grow( H.max_size );
 	for( int i = 0 ; i < H.size() ; i++ )
-	  push( **H.array[i] );
-	max_size = H.max_size ;
+	  new( array[i] ) ArrayNode( *H.array[i] );
+	Base::number_of_elements = H.size();
+}
+
+// heapify(): Floyd's bottom-up construction -- sift down every node that has a child, last one first
+//   the total work is O(n) as most nodes are near the bottom
+template<typename dataType, int arity, typename Priority, typename Hooks>
+void ArrayHeap<dataType, arity, Priority, Hooks>::heapify()
+{
+	if( Base::size() < 2 )
+	  return ;
+
+	for( int i = parent( last() ) ; i >= 0 ; i-- )
+	  siftDown( *array[i] );
+}
+
+// grow(): add a block so that 'size' nodes fit, and put its slots at the end of a bigger array
+template<typename dataType, int arity, typename Priority, typename Hooks>
+void ArrayHeap<dataType, arity, Priority, Hooks>::grow( int size )
+{
+	if( size <= max_size )
+	  return ;
+
+	Block b ;
+	b.size = size - max_size ;
+	b.nodes = static_cast<ArrayNode*>( ::operator new(b.size * sizeof(ArrayNode)) );
+	blocks.push_back( b );
+
+	ArrayNode** bigger = new ArrayNode*[ size ];
+	for( int i = 0 ; i < max_size ; i++ )
+	  bigger[i] = array[i] ;
+	for( int j = 0 ; j < b.size ; j++ )
+	  bigger[max_size + j] = b.nodes + j ;
+
+	delete [] array ;
+	array = bigger ;
+	max_size = size ;
 }
 
-// DESTRUCTOR: have to delete the array elements as they were dynamically allocated
-template<typename dataType>
-ArrayHeap<dataType>::~ArrayHeap()
+// release(): destroy the live nodes and give back the blocks and the array
+template<typename dataType, int arity, typename Priority, typename Hooks>
+void ArrayHeap<dataType, arity, Priority, Hooks>::release()
 {
-  for( int i = 0 ; i < Heap<dataType>::size() ; i++ )
-    delete array[i] ;
+  for( int i = 0 ; i < Base::size() ; i++ )
+    array[i]->~ArrayNode();
+  for( unsigned int j = 0 ; j < blocks.size() ; j++ )
+    ::operator delete( blocks[j].nodes );
+  blocks.clear();
   delete [] array ;
-  
-  cout << "ArrayHeap DESTRUCTOR called." << endl;
+  array = 0 ;
+  max_size = 0 ;
 }
 
-// ASSIGNMENT OVERLOAD: destroy the old array and copy the newly-assigned one
-template<typename dataType>
-ArrayHeap<dataType>& ArrayHeap<dataType>::operator=( const ArrayHeap<dataType>& H )
+// merge(): move the elements of H into this heap, and leave H empty
+//   an H of at least 1/MERGE_FRACTION of our size: take over its blocks, then restore the heap order
+//     the nodes of H keep their addresses, so their handles stay valid -- only the array of positions is rebuilt:
+//     our elements, those of H, then the free slots of both
+//     its elements are sifted up one by one, or all heapified in O(n), as in pushMany()
+//   a smaller H: push its elements into our free slots, O(m log n) -- its blocks stay with it, its handles are lost
+template<typename dataType, int arity, typename Priority, typename Hooks>
+void ArrayHeap<dataType, arity, Priority, Hooks>::merge( ArrayHeap<dataType, arity, Priority, Hooks>& H )
 {
-	Heap<dataType>::operator=( H );
+	if( this == &H )
+	  return ;
+
+	int n = Base::size(), m = H.size();
+	if( m * MERGE_FRACTION < n )
+	{
+		Base::merge( H );
+		return ;
+	}
+
+	ArrayNode** bigger = new ArrayNode*[ max_size + H.max_size ];
+	int k = 0 ;
+	for( int i = 0 ; i < n ; i++ )
+	  bigger[k++] = array[i] ;
+	for( int i = 0 ; i < m ; i++ )
+	{
+		// the ids of H follow ours, so its equal elements keep their order, behind ours
+		Base::renumber( *H.array[i], Base::last_id );
+		H.array[i]->index = k ;
+		bigger[k++] = H.array[i] ;
+	}
+	for( int i = n ; i < max_size ; i++ )
+	  bigger[k++] = array[i] ;
+	for( int i = m ; i < H.max_size ; i++ )
+	  bigger[k++] = H.array[i] ;
 
-	for( int i = 0 ; i < Heap<dataType>::size() ; i++ )
-	  delete array[i] ;
+	blocks.insert( blocks.end(), H.blocks.begin(), H.blocks.end() );
 	delete [] array ;
+	array = bigger ;
+	max_size += H.max_size ;
+	Base::last_id += H.last_id ;
+	Base::number_of_elements = n + m ;
+
+	if( m < PUSH_MANY_FACTOR * n )
+	  for( int i = n ; i < n + m ; i++ )
+	    siftUp( *array[i] );
+	else
+	    heapify();
+
+	// H is left empty and without storage -- its next push allocates a first block
+	H.blocks.clear();
+	delete [] H.array ;
+	H.array = 0 ;
+	H.max_size = 0 ;
+	H.number_of_elements = 0 ;
+}
 
-	array = new ArrayNode*[ H.max_size ];
-	for( int j = 0 ; j < H.size() ; j++ )
-	  push( **H.array[j] ) ;
+// reserve(): make room for at least n elements in one step
+template<typename dataType, int arity, typename Priority, typename Hooks>
+void ArrayHeap<dataType, arity, Priority, Hooks>::reserve( int n )
+{ grow( n ); }
 
-	max_size = H.max_size ;
-	return *this;
+// shrink_to_fit(): move the elements into one block just big enough for them, and give back all the others
+//   a node can sit in any block after the heap has been popped, so the blocks cannot be given back as they are:
+//   the nodes are moved, position by position, in O(n) -- which is why it invalidates every handle
+template<typename dataType, int arity, typename Priority, typename Hooks>
+void ArrayHeap<dataType, arity, Priority, Hooks>::shrink_to_fit()
+{
+	int n = Base::size();
+	if( n == max_size )
+	  return ;
+
+	Block b ;
+	b.size = n ;
+	b.nodes = static_cast<ArrayNode*>( ::operator new(b.size * sizeof(ArrayNode)) );
+
+	ArrayNode** smaller = new ArrayNode*[ n ];
+	for( int i = 0 ; i < n ; i++ )
+	{
+		smaller[i] = new( b.nodes + i ) ArrayNode( std::move(*array[i]) );
+		array[i]->~ArrayNode();
+	}
+
+	for( unsigned int k = 0 ; k < blocks.size() ; k++ )
+	  ::operator delete( blocks[k].nodes );
+	blocks.clear();
+	if( n > 0 )
+	  blocks.push_back( b );
+	else
+	  ::operator delete( b.nodes );
+
+	delete [] array ;
+	array = smaller ;
+	max_size = n ;
 }
 
+// capacity(): number of elements that fit in the current blocks
+template<typename dataType, int arity, typename Priority, typename Hooks>
+int ArrayHeap<dataType, arity, Priority, Hooks>::capacity() const
+{ return max_size ; }
+
 // swap(): swap the positions of two ArrayNodes -- used in siftUp() and siftDown()
-template<typename dataType>
-void ArrayHeap<dataType>::swap( typename Heap<dataType>::Handle& h1, typename Heap<dataType>::Handle& h2 )
+//   the nodes themselves stay put: only their two array entries and indices are exchanged
+template<typename dataType, int arity, typename Priority, typename Hooks>
+void ArrayHeap<dataType, arity, Priority, Hooks>::swap( typename Heap<dataType>::Handle& h1, typename Heap<dataType>::Handle& h2 )
 {
-	h1.swap( h2 );
 	ArrayNode& a1 = static_cast<ArrayNode&>( h1 );
 	ArrayNode& a2 = static_cast<ArrayNode&>( h2 );
+	hooks.swapped();
 
-	ArrayNode temp = *array[a1.index] ;
-	*array[a1.index] = *array[a2.index] ;
-	*array[a2.index] = temp ;
+	array[a1.index] = &a2 ;
+	array[a2.index] = &a1 ;
 
-	for( int i=0; i < Heap<dataType>::size(); i++ )
-	  (*array[i]).index = i ;
+	int temp = a1.index ;
+	a1.index = a2.index ;
+	a2.index = temp ;
 }
 
-// left(): find the array index of the left child
-template<typename dataType>
-int ArrayHeap<dataType>::left( int a ) const
+// sortFirst(): move the k highest priority nodes, in order, to the front of the array
+//   returns false -- and changes nothing -- if k is so small that k single pops are cheaper
+//   otherwise the caller MUST call removeFirst( k ) next, as the heap order is broken
+template<typename dataType, int arity, typename Priority, typename Hooks>
+bool ArrayHeap<dataType, arity, Priority, Hooks>::sortFirst( int k )
 {
-	if( Heap<dataType>::vide() )
-    throw typename Heap<dataType>::Problem();
-	
-	return (a+1)*2 - 1 ;
+	int n = Base::size();
+	if( k < 1 || k * BATCH_POP_FRACTION < n )
+	  return false ;
+
+	const Priority& p = priority ;
+	Hooks& hk = hooks ;
+	std::nth_element( array, array + k - 1, array + n,
+	                  [&p, &hk]( const ArrayNode* a, const ArrayNode* b ) { hk.compared(); return a->higherPriority( *b, p ); } );
+	std::sort( array, array + k,
+	           [&p, &hk]( const ArrayNode* a, const ArrayNode* b ) { hk.compared(); return a->higherPriority( *b, p ); } );
+	return true ;
+}
+
+// removeFirst(): destroy the k nodes at the front of the array and heapify the rest in O(n)
+template<typename dataType, int arity, typename Priority, typename Hooks>
+void ArrayHeap<dataType, arity, Priority, Hooks>::removeFirst( int k )
+{
+	int n = Base::size();
+	for( int i = 0 ; i < k ; i++ )
+	  array[i]->~ArrayNode();
+
+	// the freed slots go behind the remaining elements
+	std::rotate( array, array + k, array + n );
+	Base::number_of_elements = n - k ;
+	for( int i = 0 ; i < n - k ; i++ )
+	  array[i]->index = i ;
+
+	heapify();
 }
 
-// right(): find the arry index of the right child
-template<typename dataType>
-int ArrayHeap<dataType>::right( int a ) const
+// child(): find the array index of the first child -- the others follow it
+template<typename dataType, int arity, typename Priority, typename Hooks>
+int ArrayHeap<dataType, arity, Priority, Hooks>::child( int a ) const
 {
-	if( Heap<dataType>::vide() )
+	if( Base::vide() )
     throw typename Heap<dataType>::Problem();
 	
-	return (a+1)*2 ;
+	return a*arity + 1 ;
 }
 
 // parent(): find the array index of the parent node
-template<typename dataType>
-int ArrayHeap<dataType>::parent( int a ) const
+template<typename dataType, int arity, typename Priority, typename Hooks>
+int ArrayHeap<dataType, arity, Priority, Hooks>::parent( int a ) const
 {
-	if( Heap<dataType>::vide() )
+	if( Base::vide() )
     throw typename Heap<dataType>::Problem();
 	
-	return (a+1)/2 - 1 ;
+	return (a-1) / arity ;
 }
 
 // siftUp: move child node up the array if it is higher priority than its parent
-template<typename dataType>
-void ArrayHeap<dataType>::siftUp( typename Heap<dataType>::Handle& h )
+template<typename dataType, int arity, typename Priority, typename Hooks>
+void ArrayHeap<dataType, arity, Priority, Hooks>::siftUp( typename Heap<dataType>::Handle& h )
 {
 	ArrayNode& a = static_cast<ArrayNode&>( h );
 	int son = a.index ;
+	int levels = 0, nodes = 1 ;
 	while( son != 0 )
 	{
 		int dad = parent( son ) ;
-		if( (*array[son]).higherPriority(*array[dad]) )
+		++nodes ;
+		hooks.compared();
+		if( (*array[son]).higherPriority( *array[dad], priority ) )
 		{
 			swap( *array[son], *array[dad] );
 			son = dad ;
+			++levels ;
 		}
 		else break ;
 	}
+	hooks.sifted( SIFT_UP, levels, nodes );
 }
 
 // siftDown(): continually move a node down if it is lower priority than its highest priority child
-template<typename dataType>
-void ArrayHeap<dataType>::siftDown( typename Heap<dataType>::Handle& h )
+//   the arity children of a node are contiguous in the array, so finding the best one stays within a cache line or two
+template<typename dataType, int arity, typename Priority, typename Hooks>
+void ArrayHeap<dataType, arity, Priority, Hooks>::siftDown( typename Heap<dataType>::Handle& h )
 {
-	ArrayNode& a = dynamic_cast<ArrayNode&>( h );
+	ArrayNode& a = static_cast<ArrayNode&>( h );
 	int upper = a.index ;
+	int n = Base::size();
+	int levels = 0, nodes = 1 ;
 	while( true )
   {
-		if( left(upper) > last() )
+		int first = child( upper );
+		if( first >= n )
 		  // no children
 		  break ;
-		int hpchild ;
-		if( right(upper) > last() )
-		  // if no right then highest priority is left child
-		  hpchild = left( upper );
-		else
-			// find highest priority child
-			hpchild = ( *array[left(upper)] ).higherPriority( *array[right(upper)] ) ? left( upper ) : right( upper );
+
+		// find highest priority child
+		int end = first + arity < n ? first + arity : n ;
+		int hpchild = first ;
+		nodes += end - first ;
+		for( int c = first + 1 ; c < end ; c++ )
+		{
+		  hooks.compared();
+		  if( ( *array[c] ).higherPriority( *array[hpchild], priority ) )
+		    hpchild = c ;
+		}
 
 		// swap node and child if child is higher priority
-		if( ( *array[hpchild] ).higherPriority( *array[upper] ) )
+		hooks.compared();
+		if( ( *array[hpchild] ).higherPriority( *array[upper], priority ) )
 		{
 			swap( *array[hpchild], *array[upper] );
 			upper = hpchild ;
+			++levels ;
 		}
 		else break;
 	}
-}
-
-// createNew(): used in Heap::push()
-template<typename dataType>
-typename Heap<dataType>::Handle&  ArrayHeap<dataType>::createNew( const dataType& e )
-{
-	if( Heap<dataType>::size() >= max_size )
-	  throw typename Heap<dataType>::Problem();
-  
-	array[Heap<dataType>::size()] = new ArrayNode( e, Heap<dataType>::comparison, Heap<dataType>::ordering, Heap<dataType>::size() );
-	return *array[ Heap<dataType>::size() ];
+	hooks.sifted( SIFT_DOWN, levels, nodes );
 }
 
 // first(): reference the first element
-template<typename dataType>
-typename Heap<dataType>::Handle&  ArrayHeap<dataType>::first()
+template<typename dataType, int arity, typename Priority, typename Hooks>
+typename Heap<dataType>::Handle&  ArrayHeap<dataType, arity, Priority, Hooks>::first()
 {
-	if( Heap<dataType>::vide() )
+	if( Base::vide() )
 	  throw typename Heap<dataType>::Problem();
 	
 	return *array[0] ;
 }
 
 // last(): index of the current last element
-template<typename dataType>
-int ArrayHeap<dataType>::last() const
+template<typename dataType, int arity, typename Priority, typename Hooks>
+int ArrayHeap<dataType, arity, Priority, Hooks>::last() const
 {
-	if( Heap<dataType>::vide() || Heap<dataType>::size() > max_size )
+	if( Base::vide() || Base::size() > max_size )
 	  throw typename Heap<dataType>::Problem();
 	
-	return Heap<dataType>::size() - 1 ;
+	return Base::size() - 1 ;
 }
 
 // moveLastToFirst(): used in Heap::pop()
-template<typename dataType>
-void ArrayHeap<dataType>::moveLastToFirst()
+template<typename dataType, int arity, typename Priority, typename Hooks>
+void ArrayHeap<dataType, arity, Priority, Hooks>::moveLastToFirst()
 { swap( *array[0], *array[last()] ); }
 
 // deleteLast(): ONLY used in Heap::pop()
-template<typename dataType>
-void ArrayHeap<dataType>::deleteLast()
+template<typename dataType, int arity, typename Priority, typename Hooks>
+void ArrayHeap<dataType, arity, Priority, Hooks>::deleteLast()
 {
-	if( Heap<dataType>::vide() )
+	if( Base::vide() )
     throw typename Heap<dataType>::Problem();
 	
-	delete array[ last() ];
-}
-
-// index(): used in Heap::priorityChange()
-template<typename dataType>
-typename Heap<dataType>::Handle&  ArrayHeap<dataType>::index( const typename Heap<dataType>::Handle& h ) const
-{
-	const ArrayNode& a = dynamic_cast<const ArrayNode&>( h );
-	return *array[ a.index ];
+	// the slot stays at the end of the array, ready for the next createNew()
+	array[ last() ]->~ArrayNode();
 }
 
-// value(): used in Heap::push()
-template<typename dataType>
-typename Heap<dataType>::Handle&  ArrayHeap<dataType>::value( const dataType& t ) const
+// moveLastTo(): used in Heap::erase()
+template<typename dataType, int arity, typename Priority, typename Hooks>
+typename Heap<dataType>::Handle& ArrayHeap<dataType, arity, Priority, Hooks>::moveLastTo( typename Heap<dataType>::Handle& h )
 {
-  // return the node that has the same value as the parameter dataType
-  for( int i=0; i < Heap<dataType>::size(); i++ )
-    if( (*const_cast<dataType&>(**array[i])) == (*const_cast<dataType&>(t)) )
-      return *array[i] ;
-  
-  // NO matching value
-  throw typename Heap<dataType>::Problem();
+	ArrayNode* moved = array[ last() ];
+	swap( h, *moved );
+	return *moved ;
 }
 
 // top(): get the value at the top of the array
-template<typename dataType>
-const dataType& ArrayHeap<dataType>::top() const
+template<typename dataType, int arity, typename Priority, typename Hooks>
+const dataType& ArrayHeap<dataType, arity, Priority, Hooks>::top() const
 {
-	if( Heap<dataType>::vide() )
+	if( Base::vide() )
     throw typename Heap<dataType>::Problem();
 	
 	return **array[0] ;
 }
 
 // print(): recursively print a node and all its sub-nodes
-template<typename dataType>
-void ArrayHeap<dataType>::print( ostream& os, const ArrayHeap<dataType>::ArrayNode* n, int k ) const
+template<typename dataType, int arity, typename Priority, typename Hooks>
+void ArrayHeap<dataType, arity, Priority, Hooks>::print( ostream& os, const ArrayHeap<dataType, arity, Priority, Hooks>::ArrayNode* n, int k ) const
 {
 	for( int i=0; i < k; ++i )
 	  os << "  " ;
 
-	os << **n << "  ( this=" << (void*)n << ", index=" << n->index << ", l=" << array[left( (*n).index )]
-		 << ", r=" << array[right( (*n).index )] << ", p=" << array[parent( (*n).index )] << " )" <<  endl;
-
-	if( left( (*n).index ) <= last() )
-	  print( os, array[left( (*n).index )], k+1 );
-	else
-	{
-		for( int i=0; i < k+1; ++i )
-		  os << "  " ;
-		os << "."  << endl;
-	}
+	os << **n << "  ( this=" << (void*)n << ", index=" << n->index
+		 << ", p=" << ( n->index > 0 ? array[parent( (*n).index )] : 0 ) << " )" <<  endl;
 
-	if( right( (*n).index ) <= last() )
-	  print( os, array[right( (*n).index )], k+1 );
-	else
+	for( int c = child( (*n).index ) ; c < child( (*n).index ) + arity ; ++c )
 	{
-		for( int i=0; i < k+1; ++i )
-		  os << "  " ;
-		os << "." << endl;
+		if( c <= last() )
+		  print( os, array[c], k+1 );
+		else
+		{
+			for( int i=0; i < k+1; ++i )
+			  os << "  " ;
+			os << "."  << endl;
+		}
 	}
 }
 
 // print(): print the first and last node addresses then print the array
-template<typename dataType>
-void ArrayHeap<dataType>::print( ostream& os ) const
+template<typename dataType, int arity, typename Priority, typename Hooks>
+void ArrayHeap<dataType, arity, Priority, Hooks>::print( ostream& os ) const
 {
 	os << "First = " << array[0] << " ; Last = " << array[last()] << endl;
 	print( os, array[0] );
@@ -16,28 +16,72 @@ using namespace std;
 
 const int DEFAULT_ARRAY_SIZE = 256 ;
 
+// merge() takes over the blocks of a heap that has at least 1/MERGE_FRACTION of our elements, and pushes a smaller one
+const int MERGE_FRACTION = 4 ;
+
+// popMany() sorts the whole batch at once when it is at least 1/BATCH_POP_FRACTION of the heap
+const int BATCH_POP_FRACTION = 8 ;
+
 #include <iostream>
+#include <vector>
+#include <new>
+#include <utility>
 #include "Heap.hpp"
+#include "StaticHeap.hpp"
+#include "Priority.hpp"
+#include "Hooks.hpp"
 
 /***
   **  ArrayHeap class
   **  
-  **  - Subclass of Heap<dataType>
+  **  - Subclass of StaticHeap -- use HeapAdapter< ArrayHeap<dataType> > for a Heap<dataType>
   **  - a heap implemented as an array
+  **  - each node has 'arity' children (2, 4, 8, ...) stored next to each other,
+  **    so a wider heap is shallower and a siftDown() visits fewer cache lines
+  **  - 'Priority' decides which of two elements comes first -- see Priority.hpp
+  **    the default RuntimePriority takes the compareFxn and order given to the constructor,
+  **    a StaticPriority fixes both at compile time so that all the comparisons can be inlined
   **
   **    OPERATIONS:
   **       
   **    - const dataType& top() const; 
   **        return a reference to the top element
   ** 
+  **    - ArrayHeap( Iterator begin, Iterator end, const Priority& );
+  **        build the heap from a range (or a vector) in O(n)
+  **
+  **    - Output popMany( int k, Output out );
+  **        pop the k highest priority elements into out, in order
+  **
+  **    - void merge( ArrayHeap& );
+  **        move all the elements of the argument into this heap and leave it empty
+  **        the blocks of nodes of a heap of comparable size are taken over as they are, so the handles of both
+  **        heaps stay valid -- the elements of a much smaller heap are moved into our free slots instead,
+  **        so that merging many small heaps does not pile up their blocks: then ITS handles are lost
+  **
+  **    - void reserve( int );
+  **        make room for at least that many elements
+  **
+  **    - void shrink_to_fit();
+  **        give back the storage that is not needed by the current elements
+  **        the elements are moved into a block of their own, so it INVALIDATES ALL THE HANDLES, as
+  **        shrink_to_fit() does the iterators of a std::vector
+  **
+  **    - int capacity() const ;
+  **        the number of elements that fit without allocating
+  **
   **    - void print( ostream& ) const ;
   **        print the heap    
   **
   ***/
-template<typename dataType>
-class ArrayHeap : public Heap<dataType>
+template<typename dataType, int arity = 2, typename Priority = RuntimePriority<dataType>, typename Hooks = NoHooks >
+class ArrayHeap : public StaticHeap< ArrayHeap<dataType, arity, Priority, Hooks>, dataType >
 {
+	static_assert( arity >= 2, "an ArrayHeap has at least 2 children per node" );
+
  private:
+	typedef StaticHeap< ArrayHeap<dataType, arity, Priority, Hooks>, dataType > Base ;
+	friend class StaticHeap< ArrayHeap<dataType, arity, Priority, Hooks>, dataType > ;
 	
 	/** 
 	  *  ArrayNode class
@@ -50,54 +94,157 @@ class ArrayHeap : public Heap<dataType>
 	  public:
 		 // a variable to keep track of the array index of each ArrayNode
 		 mutable int index ;
-		 // constructor
-		 ArrayNode( const dataType&, typename Heap<dataType>::compareFxn&, typename Heap<dataType>::order&, int );
-		 // assignment
-		 ArrayNode& operator=( const ArrayNode& a );
+		 // constructor: the element is built in place from the arguments
+		 template<typename... Args>
+		 ArrayNode( int ind, long id, Args&&... args )
+		            : Heap<dataType>::Handle( typename Heap<dataType>::InPlace(), id, std::forward<Args>(args)... ),
+		              index( ind ) {}
 		 
-	 };// inner class ArrayHeap<dataType>::ArrayNode
+	 };// inner class ArrayHeap<dataType, arity, Priority, Hooks>::ArrayNode
+
+	// a contiguous block of node storage
+	struct Block
+	{
+		ArrayNode* nodes ;
+		int size ;
+	};
 
 	// print a node and all its sub-nodes
-	void print( ostream&, const ArrayHeap<dataType>::ArrayNode*, int=0 ) const ;
+	void print( ostream&, const ArrayHeap<dataType, arity, Priority, Hooks>::ArrayNode*, int=0 ) const ;
  
  protected:
 	// the variables of array_heap
+	Priority priority ;
+
+	// told about the events of the heap -- see Hooks.hpp
+	Hooks hooks ;
 	int max_size ;
+
+	// the node storage: each block is contiguous and a node is constructed in place and never moves,
+	// so a swap only has to exchange two entries of 'array' and update their two indices
+	// -- the heap grows by adding a block as big as all the previous ones together
+	std::vector<Block> blocks ;
+
+	// the heap order: array[i] is the node at position i
+	// -- the max_size - size() entries past last() point at the free slots of the blocks
 	ArrayNode** array ;
 	
 	// some useful methods
+	void grow( int );
+	void release();
+	void copy( const ArrayHeap<dataType, arity, Priority, Hooks>& );
+	void heapify();
+	bool sortFirst( int );
+	void removeFirst( int );
 	void swap( typename Heap<dataType>::Handle&, typename Heap<dataType>::Handle& );
-	int left( int ) const ;
-	int right( int ) const ;
+	int child( int ) const ;
 	int parent( int ) const ;
 	int last() const ;
 	
-	// pure virtual methods of parent class 'Heap' are declared
+	// the primitive operations used by StaticHeap
 	void siftUp( typename Heap<dataType>::Handle& );
 	void siftDown( typename Heap<dataType>::Handle& );
-	typename Heap<dataType>::Handle& createNew( const dataType& );
 	typename Heap<dataType>::Handle& first();
 	void moveLastToFirst();
 	void deleteLast();
-	typename Heap<dataType>::Handle& index( const typename Heap<dataType>::Handle& ) const ;
-  typename Heap<dataType>::Handle& value( const dataType& ) const ;
+	typename Heap<dataType>::Handle& moveLastTo( typename Heap<dataType>::Handle& );
+
+	// createNew(): used in StaticHeap::emplace() -- build the new node in the free slot already sitting at the end of the array
+	template<typename... Args>
+	typename Heap<dataType>::Handle& createNew( Args&&... args )
+	{
+		// double the capacity when full -- amortized O(1) per push
+		if( Base::size() >= max_size )
+		  grow( max_size > 0 ? 2 * max_size : DEFAULT_ARRAY_SIZE );
+
+		ArrayNode* slot = array[ Base::size() ];
+		new( slot ) ArrayNode( Base::size(), ++Base::last_id, std::forward<Args>(args)... );
+		return *slot ;
+	}
+
+	// append(): put a new element at the end without sifting it -- heapify() must follow
+	template<typename... Args>
+	typename Heap<dataType>::Handle& append( Args&&... args )
+	{
+		typename Heap<dataType>::Handle& h = createNew( std::forward<Args>(args)... );
+		++Base::number_of_elements ;
+		return h ;
+	}
+
+	// takeAll(): used in StaticHeap::merge() -- the slots stay in the array, ready for the next createNew()
+	template<typename Take>
+	void takeAll( Take take )
+	{
+		for( int i = 0 ; i < Base::size() ; i++ )
+		{
+			take( *array[i] );
+			array[i]->~ArrayNode();
+		}
+		Base::number_of_elements = 0 ;
+	}
 
  public:
-	// constructor with a default array size
+	// constructor with a default initial capacity -- for a RuntimePriority
 	ArrayHeap( typename Heap<dataType>::compareFxn, typename Heap<dataType>::order, int=DEFAULT_ARRAY_SIZE );
 
-	// copy constructor
-	ArrayHeap( const ArrayHeap<dataType>& );
+	// constructor with a Priority object -- a StaticPriority can be default-constructed
+	explicit ArrayHeap( const Priority& = Priority(), int=DEFAULT_ARRAY_SIZE );
+
+	// build the heap from all the elements of a vector or of an iterator range,
+	// bottom-up in O(n) instead of n pushes
+	ArrayHeap( const std::vector<dataType>&, const Priority& = Priority() );
+
+	template<typename Iterator>
+	ArrayHeap( Iterator begin, Iterator end, const Priority& p = Priority() )
+	           : priority( p ), max_size( 0 ), array( 0 )
+	{
+		grow( DEFAULT_ARRAY_SIZE );
+		for( ; begin != end ; ++begin )
+		  append( *begin );
+		heapify();
+		hooks.created( "ArrayHeap", Base::size() );
+	}
+
+	// copy constructor -- duplicates the nodes directly, in O(n)
+	ArrayHeap( const ArrayHeap<dataType, arity, Priority, Hooks>& );
 
 	// assignment overload
-	ArrayHeap<dataType>& operator=( const ArrayHeap<dataType>& );
+	ArrayHeap<dataType, arity, Priority, Hooks>& operator=( const ArrayHeap<dataType, arity, Priority, Hooks>& );
 
 	// destructor
 	~ArrayHeap();
 
-	// pure virtual method of parent class 'Heap' declared here
+	// the Hooks object, e.g. to read what it has recorded
+	Hooks& instrumentation() { return hooks ; }
+
+	// return a reference to the top element
 	const dataType& top() const ;
 
+	// remove the k highest priority elements and write them to out in order
+	//   a big batch is selected with nth_element and sorted, and the rest heapified: O(n + k log k)
+	//   instead of O(k log n) with scattered memory accesses
+	template<typename Output>
+	Output popMany( int k, Output out )
+	{
+		if( k > Base::size() )
+		  k = Base::size();
+		if( !sortFirst(k) )
+		  return Base::popMany( k, out );
+
+		for( int i = 0 ; i < k ; i++ )
+		  *out++ = std::move( Base::element(*array[i]) );
+		removeFirst( k );
+		return out ;
+	}
+
+	// take over the nodes of another heap, or move its elements -- see MERGE_FRACTION
+	void merge( ArrayHeap<dataType, arity, Priority, Hooks>& );
+
+	// capacity management
+	void reserve( int );
+	void shrink_to_fit();
+	int capacity() const ;
+
 	// print
 	void print( ostream& ) const ;
 
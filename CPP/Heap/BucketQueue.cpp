@@ -0,0 +1,309 @@
+/*
+ * BucketQueue.cpp
+ *   Created on: Oct 18, 2026
+ */
+
+#include "BucketQueue.hpp"
+
+/*************************************
+        BucketQueue MEMBER FUNCTIONS
+    *************************************/
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+BucketQueue<dataType, KeyOf, ordering, Hooks>::BucketQueue( key low, key high, const KeyOf& k )
+                    : keyOf( k )
+{
+  init( low, high );
+  hooks.created( "BucketQueue", 0 );
+}// BucketQueue CONSTRUCTOR
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+BucketQueue<dataType, KeyOf, ordering, Hooks>::BucketQueue( const BucketQueue<dataType, KeyOf, ordering, Hooks>& hp )
+                    : Base( hp ), keyOf( hp.keyOf ), hooks( hp.hooks )
+{
+  init( hp.lowest, key( hp.lowest + ( hp.keys - 1 ) ) );
+  copy( hp );
+  hooks.created( "BucketQueue", Base::size() );
+
+}// BucketQueue COPY CONSTRUCTOR
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+BucketQueue<dataType, KeyOf, ordering, Hooks>::~BucketQueue()
+{
+  hooks.destroyed( "BucketQueue", Base::size() );
+  destroy();
+
+}// BucketQueue DESTRUCTOR
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+BucketQueue<dataType, KeyOf, ordering, Hooks>& BucketQueue<dataType, KeyOf, ordering, Hooks>::operator=( const BucketQueue<dataType, KeyOf, ordering, Hooks>& hp )
+{
+  if( this == &hp )
+    return *this ;
+
+  destroy();
+  Base::operator=( hp );
+  keyOf = hp.keyOf ;
+  hooks = hp.hooks ;
+
+  init( hp.lowest, key( hp.lowest + ( hp.keys - 1 ) ) );
+  copy( hp );
+  return *this ;
+
+}// BucketQueue ASSIGNMENT OVERLOAD
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void BucketQueue<dataType, KeyOf, ordering, Hooks>::init( key low, key high )
+{
+  long long n = (long long)high - (long long)low + 1 ;
+  if( n < 1 || n > MAX_KEYS )
+    throw typename Heap<dataType>::Problem();
+
+  lowest = low ;
+  keys = int( n );
+  buckets.assign( keys, Bucket() );
+  for( int w = 0 ; w < MAX_KEYS / 64 ; w++ )
+    words[w] = 0 ;
+  summary = 0 ;
+
+}// init()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void BucketQueue<dataType, KeyOf, ordering, Hooks>::copy( const BucketQueue<dataType, KeyOf, ordering, Hooks>& hp )
+{
+  // same elements and ids, in the same order in each bucket
+  for( int b = 0 ; b < keys ; b++ )
+  {
+    const Bucket& q = hp.buckets[b] ;
+    for( unsigned int s = q.first ; s != q.end ; s++ )
+    {
+      unsigned int j = q.at( s );
+      if( !j )
+        continue ;
+      unsigned int i = slab.allocate();
+      BucketNode* n = new( slab[i] ) BucketNode( *hp.slab[j] );
+      n->self = i ;
+      link( n, b );
+    }
+  }
+}// copy()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void BucketQueue<dataType, KeyOf, ordering, Hooks>::destroy()
+{
+  for( int b = 0 ; b < keys ; b++ )
+  {
+    Bucket& q = buckets[b] ;
+    for( unsigned int s = q.first ; s != q.end ; s++ )
+      if( q.at( s ) )
+        slab.release( q.at( s ) );
+    q = Bucket();
+  }
+  for( int w = 0 ; w < MAX_KEYS / 64 ; w++ )
+    words[w] = 0 ;
+  summary = 0 ;
+  Base::number_of_elements = 0 ;
+
+}// destroy()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void BucketQueue<dataType, KeyOf, ordering, Hooks>::link( BucketNode* n, int b )
+{
+  Bucket& q = buckets[b] ;
+  if( q.end - q.first == q.ring.size() )
+    grow( q );
+
+  n->bucket = b ;
+  n->seq = q.end++ ;
+  q.at( n->seq ) = n->self ;
+  if( q.live++ == 0 )
+  {
+    words[ b / 64 ] |= 1ULL << ( b % 64 );
+    summary |= 1ULL << ( b / 64 );
+  }
+}// link()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void BucketQueue<dataType, KeyOf, ordering, Hooks>::unlink( BucketNode* n )
+{
+  int b = n->bucket ;
+  Bucket& q = buckets[b] ;
+  q.at( n->seq ) = 0 ;
+
+  // a hole left at the front or the back goes at once, with the ones behind it
+  if( n->seq == q.first )
+    while( q.first != q.end && !q.at( q.first ) )
+      ++q.first ;
+  else if( n->seq == q.end - 1 )
+    while( q.end != q.first && !q.at( q.end - 1 ) )
+      --q.end ;
+
+  if( --q.live == 0 )
+  {
+    words[ b / 64 ] &= ~( 1ULL << ( b % 64 ) );
+    if( !words[ b / 64 ] )
+      summary &= ~( 1ULL << ( b / 64 ) );
+  }
+}// unlink()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void BucketQueue<dataType, KeyOf, ordering, Hooks>::grow( Bucket& q )
+{
+  unsigned int size = q.ring.size();
+  if( size == 0 )
+  {
+    q.ring.assign( RING_SIZE, 0 );
+    return ;
+  }
+
+  // half holes: renumber the nodes from 0 in a ring of the same size -- the holes paid for it as they were made
+  if( 2 * q.live <= size )
+  {
+    std::vector<unsigned int> ring( size, 0 );
+    unsigned int end = 0 ;
+    for( unsigned int s = q.first ; s != q.end ; s++ )
+      if( q.at( s ) )
+      {
+        if( q.end - s > PREFETCH_AHEAD )
+          __builtin_prefetch( slab[ q.at( s + PREFETCH_AHEAD ) ], 1 );
+        slab[ q.at( s ) ]->seq = end ;
+        ring[ end++ ] = q.at( s );
+      }
+    q.ring.swap( ring );
+    q.first = 0 ;
+    q.end = end ;
+    return ;
+  }
+
+  // else twice the size: the nodes keep their sequence numbers, only their places in the ring change
+  std::vector<unsigned int> ring( 2 * size, 0 );
+  for( unsigned int s = q.first ; s != q.end ; s++ )
+    ring[ s & ( 2 * size - 1 ) ] = q.at( s );
+  q.ring.swap( ring );
+
+}// grow()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void BucketQueue<dataType, KeyOf, ordering, Hooks>::siftUp( typename Heap<dataType>::Handle& h )
+{
+  BucketNode* n = &static_cast<BucketNode&>( h );
+  link( n, n->bucket );
+
+}// siftUp()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+typename Heap<dataType>::Handle& BucketQueue<dataType, KeyOf, ordering, Hooks>::first()
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+  return *front( firstBucket() );
+
+}// first()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void BucketQueue<dataType, KeyOf, ordering, Hooks>::pop()
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+
+  int b = firstBucket();
+  BucketNode* n = front( b );
+  unlink( n );
+  slab.release( n->self );
+  --Base::number_of_elements ;
+
+  // the nodes are all over the slab, but the ring says which ones come next: start reading one of them now
+  const Bucket& q = buckets[b] ;
+  if( q.end - q.first > PREFETCH_AHEAD )
+    __builtin_prefetch( slab[ q.at( q.first + PREFETCH_AHEAD ) ] );
+
+}// pop()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void BucketQueue<dataType, KeyOf, ordering, Hooks>::erase( typename Heap<dataType>::Handle& h )
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+
+  BucketNode* n = &static_cast<BucketNode&>( h );
+  unlink( n );
+  slab.release( n->self );
+  --Base::number_of_elements ;
+
+}// erase()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void BucketQueue<dataType, KeyOf, ordering, Hooks>::priorityChange( typename Heap<dataType>::Handle& h )
+{
+  BucketNode* n = &static_cast<BucketNode&>( h );
+  int b = bucketOf( keyOf( *h ) );
+  if( b < 0 )
+    throw OutOfRange();
+
+  // the same key keeps its place, a new one goes to the end of its bucket
+  if( b == n->bucket )
+    return ;
+  unlink( n );
+  link( n, b );
+
+}// priorityChange()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void BucketQueue<dataType, KeyOf, ordering, Hooks>::priorityChange( typename Heap<dataType>::Handle& h, const dataType& e )
+{
+  if( bucketOf( keyOf( e ) ) < 0 )
+    throw OutOfRange();
+  Base::element( h ) = e ;
+  priorityChange( h );
+
+}// priorityChange()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void BucketQueue<dataType, KeyOf, ordering, Hooks>::merge( BucketQueue<dataType, KeyOf, ordering, Hooks>& hp )
+{
+  if( this == &hp )
+    return ;
+
+  // every key first: one out of our range must not leave the queues half merged
+  for( int b = 0 ; b < hp.keys ; b++ )
+    if( hp.buckets[b].live && bucketOf( keyOf( **hp.front( b ) ) ) < 0 )
+      throw OutOfRange();
+
+  // bucket by bucket, so that each key keeps its order, behind ours
+  for( int b = 0 ; b < hp.keys ; b++ )
+  {
+    const Bucket& q = hp.buckets[b] ;
+    for( unsigned int s = q.first ; s != q.end ; s++ )
+      if( q.at( s ) )
+        append( std::move( Base::element( *hp.slab[ q.at( s ) ] ) ) );
+  }
+
+  hp.destroy();
+
+}// merge()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+const dataType& BucketQueue<dataType, KeyOf, ordering, Hooks>::top() const
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+  return **front( firstBucket() );
+
+}// top()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void BucketQueue<dataType, KeyOf, ordering, Hooks>::print( ostream& os ) const
+{
+  os << "size = " << Base::size() << endl;
+  for( int b = 0 ; b < keys ; b++ )
+  {
+    const Bucket& q = buckets[b] ;
+    if( !q.live )
+      continue ;
+    os << "key " << ( ordering == Heap<dataType>::SMALLER_FIRST ? lowest + b : lowest + ( keys - 1 - b ) ) << ":" ;
+    for( unsigned int s = q.first ; s != q.end ; s++ )
+      if( q.at( s ) )
+        os << "  " << **slab[ q.at( s ) ] ;
+    os << endl;
+  }
+}// print()
@@ -0,0 +1,261 @@
+/*
+ * BucketQueue.hpp
+ *   Created on: Oct 18, 2026
+ */
+
+#ifndef MHS_CODEBLOCKS_CPP_HEAP_BUCKETQUEUE_HPP
+#define MHS_CODEBLOCKS_CPP_HEAP_BUCKETQUEUE_HPP
+
+using namespace std;
+
+#include <iostream>
+#include <vector>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include "Heap.hpp"
+#include "StaticHeap.hpp"
+#include "KeyedHeap.hpp"
+#include "Hooks.hpp"
+#include "Slab.hpp"
+
+/***
+  ** class BucketQueue - a priority queue of integer keys in a small range, one FIFO bucket per key
+  **
+  **   Subclass of StaticHeap -- use HeapAdapter< BucketQueue<dataType> > for a Heap<dataType>
+  **   'KeyOf' returns the integer key of an element -- see KeyedHeap.hpp -- and the element itself by default
+  **   the keys are from 'lowest' to 'highest', at most MAX_KEYS of them, e.g. 0 .. 255 for classes of jobs
+  **     - each key has its bucket, a FIFO of its elements in the order they came in: equal keys are first in,
+  **       first out -- with SMALLER_FIRST that is the order of the ids, as in every other heap, but with
+  **       LARGER_FIRST it is the opposite of it
+  **     - the FIFO is a ring of the slab indices of the nodes, so a pop reads the next index next to the last one
+  **       instead of following a link into another node; an element erased from the middle leaves a hole that
+  **       is skipped when it comes to the front, and a full ring that is half holes is compacted, not doubled
+  **     - a bit per bucket tells whether it is empty, and a bit per word of those bits whether the word is:
+  **       top() and pop() find the first bucket with two count-trailing-zeros
+  **     - so push(), top(), pop(), erase() and priorityChange() are all O(1) -- amortized, for the rings --
+  **       without any comparison
+  **   the nodes live in a Slab and never move
+  **
+  **    OPERATIONS:
+  **
+  **    -  BucketQueue( key lowest = 0, key highest = 255, const KeyOf& = KeyOf() );
+  **         throws a Problem for a range of more than MAX_KEYS keys
+  **
+  **    -  push(), emplace(), pushMany() and priorityChange() throw an OutOfRange -- a Problem -- for a key
+  **       out of the range; priorityChange( Handle& ) leaves the element where it was,
+  **       priorityChange( Handle&, const dataType& ) leaves it unchanged
+  **
+  **    -  void merge( BucketQueue& );
+  **         throws an OutOfRange, and leaves both queues as they were, if a key of the argument is out of the
+  **         range of this one -- it checks them all before it moves any element
+  **/
+template<typename dataType, typename KeyOf = ElementKey<dataType>,
+         typename Heap<dataType>::order ordering = Heap<dataType>::SMALLER_FIRST, typename Hooks = NoHooks >
+class BucketQueue: public StaticHeap< BucketQueue<dataType, KeyOf, ordering, Hooks>, dataType >
+{
+ public:
+  typedef typename KeyType<dataType, KeyOf>::type key ;
+
+  static_assert( std::is_integral<key>::value, "a BucketQueue has integer keys" );
+
+  // the most keys of a BucketQueue: 64 words of 64 bits -- the first ring of a bucket -- and how far ahead in
+  // a ring pop() and the compaction ask for a node
+  enum { MAX_KEYS = 64 * 64, RING_SIZE = 8, PREFETCH_AHEAD = 8 };
+
+ /**
+   *  OutOfRange class
+   *    thrown for a key out of the range of the queue
+   */
+  class OutOfRange: public Heap<dataType>::Problem
+  {
+   public:
+    const char* what() const { return "BucketQueue: the key is out of the range of the queue" ; }
+  };
+  /* inner class BucketQueue::OutOfRange */
+
+ private:
+  typedef StaticHeap< BucketQueue<dataType, KeyOf, ordering, Hooks>, dataType > Base ;
+  friend class StaticHeap< BucketQueue<dataType, KeyOf, ordering, Hooks>, dataType > ;
+
+  /***
+    ** BucketNode subclass of Heap<dataType>::Handle
+    **/
+  class BucketNode: public Heap<dataType>::Handle
+  {
+   public:
+    // the slab index of the node itself
+    unsigned int self;
+
+    // its bucket, and its sequence number in the ring of the bucket
+    int bucket;
+    unsigned int seq;
+
+    // CONSTRUCTOR: the element is built in place from the arguments
+    template<typename... Args>
+    BucketNode( unsigned int i, long id, Args&&... args )
+                : Heap<dataType>::Handle( typename Heap<dataType>::InPlace(), id, std::forward<Args>(args)... ),
+                  self( i ), bucket( 0 ), seq( 0 ) {}
+
+  };
+  /* inner class BucketQueue::BucketNode */
+
+  // the FIFO of a bucket: the slab indices of its nodes from sequence number 'first' up to 'end', in a ring
+  // of a power of 2 entries -- 0 for a hole, never at the front or the back
+  struct Bucket
+  {
+    std::vector<unsigned int> ring ;
+    unsigned int first ;
+    unsigned int end ;
+
+    // the nodes in it -- 'end - first' less the holes
+    unsigned int live ;
+
+    Bucket() : first( 0 ), end( 0 ), live( 0 ) {}
+
+    unsigned int& at( unsigned int s ) { return ring[ s & ( ring.size() - 1 ) ]; }
+    unsigned int at( unsigned int s ) const { return ring[ s & ( ring.size() - 1 ) ]; }
+  };
+
+  // the key of an element
+  KeyOf keyOf ;
+
+  // told about the events of the heap -- see Hooks.hpp
+  Hooks hooks ;
+
+  // the storage of the nodes
+  Slab<BucketNode> slab ;
+
+  // the first key
+  key lowest ;
+
+  // the number of keys
+  int keys ;
+
+  // the FIFO of each key -- bucket 0 comes first, whatever the order
+  std::vector<Bucket> buckets ;
+
+  // bit b%64 of word b/64 is set if bucket b is not empty, and bit w of 'summary' if word w is not 0
+  unsigned long long words[ MAX_KEYS / 64 ] ;
+  unsigned long long summary ;
+
+  // the bucket of a key, -1 if it is out of the range
+  int bucketOf( const key& k ) const
+  {
+    long long b = (long long)k - (long long)lowest ;
+    if( b < 0 || b >= keys )
+      return -1 ;
+    return ordering == Heap<dataType>::SMALLER_FIRST ? int( b ) : keys - 1 - int( b );
+  }
+
+  // the first bucket that is not empty -- the queue is not empty
+  int firstBucket() const
+  {
+    int w = __builtin_ctzll( summary );
+    return 64 * w + __builtin_ctzll( words[w] );
+  }
+
+  // the node at the front of a bucket that is not empty
+  BucketNode* front( int b ) const
+  {
+    const Bucket& q = buckets[b] ;
+    return slab[ q.at( q.first ) ];
+  }
+
+  // put a node at the end of a bucket, or take it out of its bucket
+  void link( BucketNode*, int );
+  void unlink( BucketNode* );
+
+  // make room at the end of a full ring
+  void grow( Bucket& );
+
+  // construct a new node in the slab, with the next id
+  template<typename... Args>
+  BucketNode* make( Args&&... args )
+  {
+    unsigned int i = slab.allocate();
+    BucketNode* n = new( slab[i] ) BucketNode( i, ++Base::last_id, std::forward<Args>(args)... );
+    n->bucket = bucketOf( keyOf( **n ) );
+    if( n->bucket < 0 )
+    {
+      slab.release( i );
+      --Base::last_id ;
+      throw OutOfRange();
+    }
+    return n ;
+  }
+
+  // empty buckets for the range
+  void init( key, key );
+
+  // duplicate the buckets of another queue
+  void copy( const BucketQueue<dataType, KeyOf, ordering, Hooks>& );
+
+  // release every node
+  void destroy();
+
+ protected:
+
+  // see StaticHeap.hpp
+  // the primitive operations used by StaticHeap -- there are no sifts in a bucket queue:
+  // siftUp() puts a new node at the end of its bucket, and pop(), erase() and priorityChange() are its own
+  //
+  void siftUp( typename Heap<dataType>::Handle& );
+  template<typename... Args>
+  typename Heap<dataType>::Handle& createNew( Args&&... args )
+  {
+    return *make( std::forward<Args>(args)... );
+  }
+  typename Heap<dataType>::Handle& first();
+  template<typename... Args>
+  typename Heap<dataType>::Handle& append( Args&&... args )
+  {
+    typename Heap<dataType>::Handle& h = createNew( std::forward<Args>(args)... );
+    ++Base::number_of_elements ;
+    siftUp( h );
+    return h ;
+  }
+  void heapify() {}
+
+ public:
+
+  // usual constructor and destructor business
+  explicit BucketQueue( key = 0, key = 255, const KeyOf& = KeyOf() );
+
+  // build the queue from all the elements of an iterator range, in O(n) -- not from two integers, the range of keys
+  template<typename Iterator, typename = typename std::enable_if< !std::is_integral<Iterator>::value >::type>
+  BucketQueue( Iterator begin, Iterator end, key low = 0, key high = 255, const KeyOf& k = KeyOf() )
+               : keyOf( k )
+  {
+    init( low, high );
+    for( ; begin != end ; ++begin )
+      append( *begin );
+    hooks.created( "BucketQueue", Base::size() );
+  }
+
+  BucketQueue( const BucketQueue<dataType, KeyOf, ordering, Hooks>& );
+  BucketQueue<dataType, KeyOf, ordering, Hooks>& operator=( const BucketQueue<dataType, KeyOf, ordering, Hooks>& );
+  ~BucketQueue();
+
+  // the Hooks object, e.g. to read what it has recorded
+  Hooks& instrumentation() { return hooks ; }
+
+  // used for debugging
+  void print( ostream& ) const ;
+
+  const dataType& top() const ;
+
+  // remove the top element, or any element -- replace the ones of StaticHeap, which need a complete tree
+  void pop();
+  void erase( typename Heap<dataType>::Handle& );
+
+  // move the element to the end of the bucket of its new key, if the key changed -- see the class comment
+  void priorityChange( typename Heap<dataType>::Handle& );
+  void priorityChange( typename Heap<dataType>::Handle&, const dataType& );
+
+  // move all the elements of another queue into this one -- see the class comment
+  void merge( BucketQueue<dataType, KeyOf, ordering, Hooks>& );
+
+};// class BucketQueue
+
+#endif // MHS_CODEBLOCKS_CPP_HEAP_BUCKETQUEUE_HPP
@@ -0,0 +1,208 @@
+/*
+ * ConcurrentHeap.cpp
+ *   Created on: Oct 18, 2026
+ */
+
+#include <thread>
+#include "ConcurrentHeap.hpp"
+
+// init(): all the records free and idle
+template<typename Impl>
+void ConcurrentHeap<Impl>::init()
+{
+	combining.store( false );
+	used.store( 0 );
+	count.store( heap.size() );
+	for( int i = 0 ; i < COMBINING_SLOTS ; i++ )
+	{
+		records[i].taken.store( false );
+		records[i].pending.store( NONE );
+	}
+}
+
+// slot(): each thread gets its own record number the first time it uses any ConcurrentHeap
+template<typename Impl>
+int ConcurrentHeap<Impl>::slot()
+{
+	static std::atomic<int> threads( 0 );
+	thread_local int s = threads++ % COMBINING_SLOTS ;
+	return s ;
+}
+
+// acquire(): take the thread's own record -- if more threads than records share it, try the next ones
+template<typename Impl>
+typename ConcurrentHeap<Impl>::Record& ConcurrentHeap<Impl>::acquire()
+{
+	int i = slot();
+	while( true )
+	{
+		bool free = false ;
+		if( records[i].taken.compare_exchange_strong(free, true, std::memory_order_acquire) )
+		  break ;
+		i = ( i + 1 ) % COMBINING_SLOTS ;
+		if( i == slot() )
+		  std::this_thread::yield();
+	}
+
+	// the combiner only scans the records below 'used'
+	int u = used.load( std::memory_order_relaxed );
+	while( u <= i && !used.compare_exchange_weak(u, i + 1) )
+	  ;
+
+	return records[i] ;
+}
+
+// release()
+template<typename Impl>
+void ConcurrentHeap<Impl>::release( Record& r )
+{ r.taken.store( false, std::memory_order_release ); }
+
+// submit(): publish the request, then either become the combiner or wait for one to answer
+template<typename Impl>
+void ConcurrentHeap<Impl>::submit( Record& r, request q )
+{
+	r.pending.store( q, std::memory_order_release );
+
+	while( r.pending.load(std::memory_order_acquire) != NONE )
+	{
+		if( !combining.load(std::memory_order_relaxed) && !combining.exchange(true, std::memory_order_acquire) )
+		{
+			combine();
+			combining.store( false, std::memory_order_release );
+		}
+		else
+		  std::this_thread::yield();
+	}
+}
+
+// combine(): apply every pending request, and keep scanning while new ones keep coming
+template<typename Impl>
+void ConcurrentHeap<Impl>::combine()
+{
+	for( int pass = 0 ; pass < COMBINING_PASSES ; pass++ )
+	{
+		bool found = false ;
+		int n = used.load( std::memory_order_acquire );
+		for( int i = 0 ; i < n ; i++ )
+		  if( records[i].pending.load(std::memory_order_acquire) != NONE )
+		  {
+			  apply( records[i] );
+			  found = true ;
+		  }
+
+		if( !found )
+		  break ;
+	}
+	count.store( heap.size(), std::memory_order_release );
+}
+
+// apply(): one request, on behalf of the thread that owns the record
+//   whatever the heap throws -- a Problem, a subclass of it, std::bad_alloc... -- is handed back to that thread
+template<typename Impl>
+void ConcurrentHeap<Impl>::apply( Record& r )
+{
+	r.ok = true ;
+	r.error = nullptr ;
+	try
+	{
+		switch( r.pending.load(std::memory_order_relaxed) )
+		{
+			case PUSH:
+			  r.handle = &heap.push( *r.in );
+			  break ;
+			case PUSH_MOVE:
+			  // the thread handed over its rvalue, so it may be moved from
+			  r.handle = &heap.push( std::move(*const_cast<dataType*>(r.in)) );
+			  break ;
+			case POP:
+			  if( heap.vide() )
+			    r.ok = false ;
+			  else
+			    *r.out = heap.popValue();
+			  break ;
+			case CHANGE:
+			  heap.priorityChange( *r.handle, *r.in );
+			  break ;
+			default:
+			  break ;
+		}
+	}
+	catch( ... )
+	{
+		r.ok = false ;
+		r.error = std::current_exception();
+	}
+	r.pending.store( NONE, std::memory_order_release );
+}
+
+// finish(): the exception is taken out of the record first, as another thread may get the record once it is released
+template<typename Impl>
+void ConcurrentHeap<Impl>::finish( Record& r )
+{
+	std::exception_ptr error ;
+	error.swap( r.error );
+	release( r );
+
+	if( error )
+	  std::rethrow_exception( error );
+}
+
+// push()
+template<typename Impl>
+typename ConcurrentHeap<Impl>::Handle& ConcurrentHeap<Impl>::push( const dataType& e )
+{
+	Record& r = acquire();
+	r.in = &e ;
+	submit( r, PUSH );
+	Handle* h = r.handle ;
+	finish( r );
+
+	return *h ;
+}
+
+// push(): moving the element in
+template<typename Impl>
+typename ConcurrentHeap<Impl>::Handle& ConcurrentHeap<Impl>::push( dataType&& e )
+{
+	Record& r = acquire();
+	r.in = &e ;
+	submit( r, PUSH_MOVE );
+	Handle* h = r.handle ;
+	finish( r );
+
+	return *h ;
+}
+
+// tryPop(): false, and 'e' untouched, if the heap was empty when the request was applied
+template<typename Impl>
+bool ConcurrentHeap<Impl>::tryPop( dataType& e )
+{
+	Record& r = acquire();
+	r.out = &e ;
+	submit( r, POP );
+	bool ok = r.ok ;
+	finish( r );
+
+	return ok ;
+}
+
+// priorityChange()
+template<typename Impl>
+void ConcurrentHeap<Impl>::priorityChange( Handle& h, const dataType& e )
+{
+	Record& r = acquire();
+	r.handle = &h ;
+	r.in = &e ;
+	submit( r, CHANGE );
+	finish( r );
+}
+
+// vide()
+template<typename Impl>
+bool ConcurrentHeap<Impl>::vide() const
+{ return count.load( std::memory_order_acquire ) == 0 ; }
+
+// size()
+template<typename Impl>
+int ConcurrentHeap<Impl>::size() const
+{ return count.load( std::memory_order_acquire ); }
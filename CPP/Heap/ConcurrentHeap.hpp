@@ -0,0 +1,129 @@
+/*
+ * ConcurrentHeap.hpp
+ *   Created on: Oct 18, 2026
+ */
+
+#ifndef MHS_CODEBLOCKS_CPP_HEAP_CONCURRENTHEAP_HPP
+#define MHS_CODEBLOCKS_CPP_HEAP_CONCURRENTHEAP_HPP
+
+#include <atomic>
+#include <exception>
+#include <utility>
+#include "Heap.hpp"
+
+// the number of publication records -- more threads than this share them
+const int COMBINING_SLOTS = 64 ;
+
+// how many times the combiner scans the records for new requests before it gives up its role
+const int COMBINING_PASSES = 3 ;
+
+/***
+  **  ConcurrentHeap class
+  **
+  **    - a heap that any number of threads can use at the same time, by FLAT COMBINING:
+  **      a thread publishes its request in its own record, then whichever thread gets the
+  **      combiner role applies ALL the pending requests to the wrapped heap in one go
+  **    - the wrapped heap 'Impl' (ArrayHeap, LinkHeap, ...) is only ever touched by the combiner,
+  **      so it needs no locking of its own and its ids stay a plain per-heap counter;
+  **      the cache lines of the heap stay with one thread for a whole batch instead of
+  **      bouncing between the threads as they would under a mutex
+  **    - whatever the wrapped heap throws for a request is thrown again, as it is, in the thread that made it
+  **    - e.g. ConcurrentHeap< ArrayHeap< long, 4, StaticPriority<long> > > h ;
+  **
+  **    OPERATIONS:
+  **
+  **    -  Handle& push( const dataType& );
+  **    -  Handle& push( dataType&& );
+  **         insert a new element and return its handle
+  **
+  **    -  bool tryPop( dataType& );
+  **         move the top element into the argument and remove it -- false if the heap is empty
+  **
+  **    -  void priorityChange( Handle&, const dataType& );
+  **         give the element a new value and update its position
+  **         -- a handle must not be used after its element has been popped
+  **
+  **    -  bool vide() const ;
+  **    -  int size() const ;
+  **         the state after the last batch of requests was applied
+  **
+  ***/
+template<typename Impl>
+class ConcurrentHeap
+{
+ public:
+	typedef typename Impl::value_type value_type ;
+	typedef typename Heap<value_type>::Handle Handle ;
+
+ private:
+	typedef typename Impl::value_type dataType ;
+
+	// what a thread asks the combiner to do
+	enum request { NONE, PUSH, PUSH_MOVE, POP, CHANGE };
+
+	// the publication record of a thread: filled in by the thread, applied and answered by the combiner
+	struct alignas(64) Record
+	{
+		// a thread is using this record
+		std::atomic<bool> taken ;
+		// the request waiting to be applied -- NONE once it is done
+		std::atomic<int> pending ;
+
+		// the arguments and the answer -- 'error' is what the heap threw, if anything
+		const dataType* in ;
+		dataType* out ;
+		Handle* handle ;
+		bool ok ;
+		std::exception_ptr error ;
+	};
+
+	// the wrapped heap
+	Impl heap ;
+
+	// a thread is combining
+	std::atomic<bool> combining ;
+
+	// the records that have ever been used are the first 'used' ones
+	std::atomic<int> used ;
+
+	// the size of the heap after the last batch
+	std::atomic<int> count ;
+
+	Record records[ COMBINING_SLOTS ];
+
+	// set up the records
+	void init();
+
+	// get a record for the calling thread, and give it back
+	Record& acquire();
+	void release( Record& );
+
+	// publish the request in the record and wait until a combiner has applied it
+	void submit( Record&, request );
+
+	// give back the record, then throw again what the heap threw for the request, if anything
+	void finish( Record& );
+
+	// apply all the pending requests
+	void combine();
+	void apply( Record& );
+
+	// the record this thread tries first
+	static int slot();
+
+ public:
+	// CONSTRUCTOR: the arguments are passed on to the constructor of Impl
+	template<typename... Args>
+	ConcurrentHeap( Args&&... args ) : heap( std::forward<Args>(args)... )
+	{ init(); }
+
+	Handle& push( const dataType& );
+	Handle& push( dataType&& );
+	bool tryPop( dataType& );
+	void priorityChange( Handle&, const dataType& );
+	bool vide() const ;
+	int size() const ;
+
+};// class ConcurrentHeap
+
+#endif // MHS_CODEBLOCKS_CPP_HEAP_CONCURRENTHEAP_HPP
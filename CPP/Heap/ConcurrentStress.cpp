@@ -0,0 +1,227 @@
+/*
+ * ConcurrentStress.cpp
+ *   Created on: Oct 18, 2026
+ *
+ *   a stress test of the ConcurrentHeap and the MultiQueue, meant to be built with -fsanitize=thread -- see the
+ *   ConcurrentStress target
+ *     - 1, 2, 4, ... up to max_threads threads push, pop and change elements at the same time
+ *     - then it checks that nothing was lost or made up, and that the ConcurrentHeap still gives its elements
+ *       in order -- a MultiQueue is relaxed, so for it only that its count is exact and that it gives them all back
+ *     - and that an exception thrown by the wrapped heap reaches the thread that made the request, as it is
+ *
+ *   usage: ConcurrentStress [ max_threads [ operations ] ]
+ *   prints one line per check: structure,threads,check,OK|FAILED -- and returns the number of checks FAILED
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+// the templates are compiled here for 'long' -- see Instance.cpp
+#include "Heap.cpp"
+#include "StaticHeap.cpp"
+#include "Slab.cpp"
+#include "ArrayHeap.cpp"
+#include "RadixHeap.cpp"
+#include "ConcurrentHeap.cpp"
+#include "MultiQueue.cpp"
+
+typedef StaticPriority<long> LongPriority ;
+typedef ArrayHeap<long, 4, LongPriority> LongHeap ;
+typedef MultiQueue<long, 4, LongPriority> LongMultiQueue ;
+
+// a random number from a generator of the calling thread
+long randomNumber( unsigned int& x )
+{
+  x ^= x << 13 ;
+  x ^= x >> 17 ;
+  x ^= x << 5 ;
+  return x % 100000 ;
+}
+
+// print the result of a check, and count it if it FAILED
+int report( const char* structure, int threads, const char* check, bool ok )
+{
+  cout << structure << ',' << threads << ',' << check << ',' << ( ok ? "OK" : "FAILED" ) << endl;
+  return ok ? 0 : 1 ;
+}
+
+// run 'body( t )' in each of 'threads' threads and wait for all of them
+template<typename Body>
+void together( int threads, Body body )
+{
+  std::vector<std::thread> workers ;
+  for( int t = 0 ; t < threads ; t++ )
+    workers.push_back( std::thread( body, t ) );
+  for( unsigned int t = 0 ; t < workers.size() ; t++ )
+    workers[t].join();
+}
+
+// pop everything left, and check that it comes out in order
+bool drain( ConcurrentHeap<LongHeap>& h, std::vector<long>& out )
+{
+  bool inOrder = true ;
+  long k ;
+  while( h.tryPop(k) )
+  {
+    if( !out.empty() && k < out.back() )
+      inOrder = false ;
+    out.push_back( k );
+  }
+  return inOrder ;
+}
+
+// pushes and pops: the elements popped, and those left, are exactly those pushed
+int pushPop( int threads, long operations )
+{
+  ConcurrentHeap<LongHeap> h ;
+  std::vector< std::vector<long> > pushed( threads ), popped( threads );
+
+  together( threads, [&]( int t )
+  {
+    unsigned int x = 2463534242u + 7919u * t ;
+    long k ;
+    for( long i = 0 ; i < operations / threads ; i++ )
+      if( i % 3 == 2 )
+      {
+        if( h.tryPop(k) )
+          popped[t].push_back( k );
+      }
+      else
+      {
+        k = randomNumber( x );
+        h.push( k );
+        pushed[t].push_back( k );
+      }
+  } );
+
+  std::vector<long> in, out, left ;
+  for( int t = 0 ; t < threads ; t++ )
+  {
+    in.insert( in.end(), pushed[t].begin(), pushed[t].end() );
+    out.insert( out.end(), popped[t].begin(), popped[t].end() );
+  }
+  bool inOrder = drain( h, left );
+  out.insert( out.end(), left.begin(), left.end() );
+  std::sort( in.begin(), in.end() );
+  std::sort( out.begin(), out.end() );
+
+  return report( "flat_combining", threads, "push_pop_multiset", in == out )
+       + report( "flat_combining", threads, "drain_in_order", inOrder );
+}
+
+// each thread pushes its elements and changes them through their handles: the heap stays in order
+int changes( int threads, long operations )
+{
+  ConcurrentHeap<LongHeap> h ;
+  long each = operations / threads / 2 ;
+
+  together( threads, [&]( int t )
+  {
+    for( long i = 0 ; i < each ; i++ )
+    {
+      long k = t * each + i ;
+      ConcurrentHeap<LongHeap>::Handle& e = h.push( k );
+      h.priorityChange( e, -k );
+    }
+  } );
+
+  std::vector<long> left ;
+  bool inOrder = drain( h, left );
+  return report( "flat_combining", threads, "priority_change", inOrder && (long)left.size() == threads * each );
+}
+
+// every thread pushes a key before the last one popped from a RadixHeap: each gets the OutOfOrder back
+int exceptions( int threads )
+{
+  ConcurrentHeap< RadixHeap<long> > h ;
+  h.push( 100 );
+  long k ;
+  h.tryPop( k );
+
+  std::vector<int> caught( threads, 0 );
+  together( threads, [&]( int t )
+  {
+    for( int i = 0 ; i < 100 ; i++ )
+      try
+      {
+        h.push( 99 - i );
+      }
+      catch( RadixHeap<long>::OutOfOrder& )
+      {
+        ++caught[t] ;
+      }
+      catch( ... )
+      {
+      }
+  } );
+
+  bool ok = h.vide() ;
+  for( int t = 0 ; t < threads ; t++ )
+    ok = ok && caught[t] == 100 ;
+  return report( "flat_combining", threads, "exceptions", ok );
+}
+
+// pushes and pops on a MultiQueue: the elements popped, and those left, are exactly those pushed
+int relaxed( int threads, long operations )
+{
+  LongMultiQueue q( threads );
+  std::vector< std::vector<long> > pushed( threads ), popped( threads );
+
+  together( threads, [&]( int t )
+  {
+    unsigned int x = 88675123u + 7919u * t ;
+    long k ;
+    for( long i = 0 ; i < operations / threads ; i++ )
+      if( i % 3 == 2 )
+      {
+        if( q.tryPop(k) )
+          popped[t].push_back( k );
+      }
+      else
+      {
+        k = randomNumber( x );
+        q.push( k );
+        pushed[t].push_back( k );
+      }
+  } );
+
+  std::vector<long> in, out ;
+  for( int t = 0 ; t < threads ; t++ )
+  {
+    in.insert( in.end(), pushed[t].begin(), pushed[t].end() );
+    out.insert( out.end(), popped[t].begin(), popped[t].end() );
+  }
+  long size = q.size(), left = 0, k ;
+  while( q.tryPop(k) )
+  {
+    out.push_back( k );
+    ++left ;
+  }
+  std::sort( in.begin(), in.end() );
+  std::sort( out.begin(), out.end() );
+
+  return report( "multiqueue", threads, "push_pop_multiset", in == out )
+       + report( "multiqueue", threads, "drain_all", left == size && q.vide() );
+}
+
+int main( int argc, char* argv[] )
+{
+  int maxThreads = argc > 1 ? atoi( argv[1] ) : 16 ;
+  long operations = argc > 2 ? atol( argv[2] ) : 200000 ;
+
+  cout << "# hardware threads: " << std::thread::hardware_concurrency() << endl;
+  cout << "structure,threads,check,result" << endl;
+
+  int failed = 0 ;
+  for( int threads = 1 ; threads <= maxThreads ; threads *= 2 )
+  {
+    failed += pushPop( threads, operations );
+    failed += changes( threads, operations );
+    failed += exceptions( threads );
+    failed += relaxed( threads, operations );
+  }
+  return failed ;
+}
@@ -0,0 +1,153 @@
+/*
+ * DijkstraBench.cpp
+ *   Created on: Oct 18, 2026
+ *
+ *   Dijkstra's shortest paths on random graphs: a mix of push(), pop() and decrease-key
+ *   -- priorityChange( Handle&, const dataType& ) -- with the PairingHeap and the RadixHeap against the ArrayHeaps
+ *   the denser the graph, the more decrease-keys per pop
+ *
+ *   usage: DijkstraBench [ vertices [ repeats ] ]
+ *   prints CSV: heap,vertices,degree,pops,decrease_keys,ms,checksum
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+// the templates are compiled here for 'Entry' -- see Instance.cpp
+#include "Heap.cpp"
+#include "StaticHeap.cpp"
+#include "Slab.cpp"
+#include "ArrayHeap.cpp"
+#include "PairingHeap.cpp"
+#include "RadixHeap.cpp"
+
+// a vertex and its tentative distance
+struct Entry
+{
+  long dist ;
+  int vertex ;
+};
+
+// the nearest vertex comes first
+struct ByDistance
+{
+  bool operator()( const Entry& a, const Entry& b ) const
+  { return a.dist < b.dist ; }
+};
+
+typedef StaticPriority<Entry, ByDistance> EntryPriority ;
+
+// the distance is the key of the RadixHeap -- the distances popped never go down
+struct EntryDistance
+{
+  long operator()( const Entry& e ) const
+  { return e.dist ; }
+};
+
+// a graph with 'degree' random edges out of each vertex, plus the edge i -> i+1 so that every vertex is reachable
+//   stored as adjacency arrays: the edges of vertex v are first[v] .. first[v+1]-1
+struct Graph
+{
+  std::vector<int> first ;
+  std::vector<int> target ;
+  std::vector<int> weight ;
+
+  Graph( int n, int degree, unsigned int seed )
+  {
+    for( int v = 0 ; v < n ; v++ )
+    {
+      first.push_back( target.size() );
+      target.push_back( (v + 1) % n );
+      weight.push_back( 1000 );
+      for( int e = 0 ; e < degree ; e++ )
+      {
+        seed = seed * 1103515245u + 12345u ;
+        target.push_back( (seed >> 8) % n );
+        seed = seed * 1103515245u + 12345u ;
+        weight.push_back( 1 + (seed >> 8) % 1000 );
+      }
+    }
+    first.push_back( target.size() );
+  }
+};
+
+// shortest paths from vertex 0 -- returns the sum of the distances, to check that all the heaps agree
+template<typename Queue>
+long dijkstra( const Graph& g, long& pops, long& decreases )
+{
+  int n = g.first.size() - 1 ;
+  std::vector<long> dist( n, -1 );
+  std::vector<typename Heap<Entry>::Handle*> handle( n, (typename Heap<Entry>::Handle*)0 );
+  std::vector<bool> done( n, false );
+  Queue q ;
+
+  Entry s = { 0, 0 };
+  handle[0] = &q.push( s );
+  dist[0] = 0 ;
+  while( !q.vide() )
+  {
+    Entry u = q.popValue();
+    done[ u.vertex ] = true ;
+    ++pops ;
+
+    for( int e = g.first[u.vertex] ; e < g.first[u.vertex + 1] ; e++ )
+    {
+      int v = g.target[e] ;
+      long d = u.dist + g.weight[e] ;
+      if( done[v] || ( dist[v] >= 0 && dist[v] <= d ) )
+        continue ;
+
+      Entry x = { d, v };
+      if( dist[v] < 0 )
+        handle[v] = &q.push( x );
+      else
+      {
+        q.priorityChange( *handle[v], x );
+        ++decreases ;
+      }
+      dist[v] = d ;
+    }
+  }
+
+  long sum = 0 ;
+  for( int v = 0 ; v < n ; v++ )
+    sum += dist[v] ;
+  return sum ;
+}
+
+// the best of 'repeats' runs
+template<typename Queue>
+void run( const char* name, const Graph& g, int degree, int repeats )
+{
+  double best = 0 ;
+  long pops = 0, decreases = 0, sum = 0 ;
+  for( int r = 0 ; r < repeats ; r++ )
+  {
+    pops = decreases = 0 ;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    sum = dijkstra<Queue>( g, pops, decreases );
+    std::chrono::duration<double, std::milli> ms = std::chrono::steady_clock::now() - start ;
+    if( r == 0 || ms.count() < best )
+      best = ms.count();
+  }
+  cout << name << ',' << g.first.size() - 1 << ',' << degree << ',' << pops << ',' << decreases << ',' << best << ',' << sum << endl;
+}
+
+int main( int argc, char* argv[] )
+{
+  int n = argc > 1 ? atoi( argv[1] ) : 1000000 ;
+  int repeats = argc > 2 ? atoi( argv[2] ) : 3 ;
+
+  cout << "heap,vertices,degree,pops,decrease_keys,ms,checksum" << endl;
+  for( int degree = 2 ; degree <= 32 ; degree *= 4 )
+  {
+    Graph g( n, degree, 12345 );
+    run< ArrayHeap<Entry, 2, EntryPriority> >( "array2", g, degree, repeats );
+    run< ArrayHeap<Entry, 4, EntryPriority> >( "array4", g, degree, repeats );
+    run< PairingHeap<Entry, EntryPriority> >( "pairing", g, degree, repeats );
+    run< RadixHeap<Entry, EntryDistance> >( "radix", g, degree, repeats );
+  }
+  return 0 ;
+}
@@ -13,6 +13,9 @@
 #define MHS_CODEBLOCKS_CPP_HEAP_HEAP_HPP
 
 #include <iostream>
+#include <utility>
+
+template<typename Derived, typename dataType> class StaticHeap ;
 
 /***
   **  HEAP class
@@ -26,20 +29,38 @@
   **         remove the top element    
   **
   **    -  handle& push( const dataType& );
+  **    -  handle& push( dataType&& );
   **         insert a new element and return its handle
-  **         this handle can be used to update its position
-  **         within the heap, if its priority has changed at run-time
+  **         the handle stays with that element until it is popped, and
+  **         can be used to update its position within the heap,
+  **         if its priority has changed at run-time
+  **         an rvalue is moved into the heap instead of copied
+  **
+  **    -  dataType popValue();
+  **         remove the top element and return it, moved out of the heap
+  **
+  **    -  void erase( Handle& );
+  **         remove the element with that handle, wherever it is -- the other handles stay valid
   **
   **    -  void priorityChange( Handle& );
   **         update the elements position in the heap because
   **         its priority has changed asynchronously
   **
+  **    -  void merge( Heap& );
+  **         move all the elements of the argument into this heap and leave it empty
+  **         HeapAdapter melds two heaps of the same implementation directly -- see ArrayHeap, LeftistHeap and PairingHeap
+  **
   **    -  bool empty() const;
   **         returns true if and only if heap is empty
   **
   **    -  int size() const;
   **         returns the number of elements stored in the heap
   **
+  **    Heap<dataType> itself is only the runtime-polymorphic INTERFACE, plus the types every heap shares.
+  **    The implementations (ArrayHeap, LinkHeap) derive from StaticHeap, which dispatches to them
+  **    at compile time so that the sift loops can be inlined.  Wrap one in a HeapAdapter to use it
+  **    through a Heap<dataType>& -- see StaticHeap.hpp and HeapAdapter.hpp
+  **
   ***/
 template<typename dataType>
 class Heap
@@ -64,11 +85,13 @@ class Heap
 	  class Problem
 	  {
 	   public:
-			Problem()
-			{ std::cerr << ">> Heap problem!" << std::endl; }
+			Problem() {}
 	  };
     /* inner class Heap<dataType>::Problem */
 	  
+		// tag for the constructors that build the element in place -- see emplace()
+		struct InPlace {};
+
 	 /** 
 	   *  Handle class
 	   *    - an abstract class, so must be subclassed
@@ -78,19 +101,11 @@ class Heap
     {
 			private:
 				// ALL PRIVATE, SO SUBCLASSES SHOULD NOT CONCERN THEMSELVES WITH LOW LEVEL DETAILS
-	      
-				// used to generate a unique id
-				static long last_id ;
-				
+
 				// a unique id, which helps to establish
 				// temporal ordering if two nodes have the same priority
+				// -- each heap numbers its own elements, see StaticHeap::last_id
 				long id ;
-				
-				// a reference to the actual ordering function - see the typedef above
-				compareFxn& handleComparison ;
-
-				// a reference to the heap's ordering - see the enum above
-				order& handleOrdering ;
 
 			protected:
 				// PROTECTED SECTION -- SUBCLASSES MOST PROBABLY NEED THEM BUT THE PUBLIC SHOULD NOT!
@@ -100,75 +115,37 @@ class Heap
 
 				// even the constructor is 'protected'
 				// only heap and its subclasses should create handles!
-				Handle( compareFxn&, order&, const dataType& );
+				// the element is constructed from any arguments of its own constructors -- an rvalue is moved in
+				// and 'i' is the id the heap gives it
+				template<typename... Args>
+				Handle( InPlace, long i, Args&&... args ) : id( i ), elem( std::forward<Args>(args)... ) {}
+
+				// StaticHeap moves the element out in popValue()
+				template<typename Derived, typename T> friend class StaticHeap ;
 
 			public:
 				// INTERFACE
 
 				// if h is a handle, *h is the element it stores
-				virtual const dataType& operator*() const ;
+				const dataType& operator*() const ;
 
 				// returns true that "this" is higher priority than the argument
-				virtual bool higherPriority( const Handle& );
+				// the heap passes in its Priority object -- see Priority.hpp
+				template<typename Priority>
+				bool higherPriority( const Handle& h, const Priority& p ) const
+				{ return p( elem, id, h.elem, h.id ); }
 
-				// swap "this" with the argument
-				// subclasses probably have to overload this method to swap other instance variables declared there
-				// if that is the case, they should call this swap as well, to have the internal id's swapped
-				virtual void swap( Handle& );
+				// swap "this" with the argument -- the elements are moved, not copied
+				// subclasses that swap other instance variables declared there
+				// should call this swap as well, to have the internal id's swapped
+				void swap( Handle& );
 
     };
 	  /* inner class Heap<dataType>::Handle */
 
-  protected:
-		// PROTECTED SECTION -- SUBCLASSES PROBABLY NEED ACCESS TO THE FOLLOWING INSTANCE VARIABLES
-
-		// the function to establish ordering
-		compareFxn comparison ;
-
-		// the ordering property of this heap
-		order ordering ;
-
-    // the number of elements currently stored in the heap
-    int number_of_elements ;
-
-		// THE FOLLOWING METHODS FORM A 'PROTECTED' INTERFACE TO THE SUBCLASSES OF STANDARD HEAP OPERATIONS
-		//
-		// THE PUBLIC INTERFACE IS IMPLEMENTED USING THESE PRIMITIVE HEAP OPERATIONS
-
-		// the 'sift up' operation, start at the argument
-		virtual void siftUp( Handle& ) = 0 ;
-
-		// the 'sift down' operation, start at the argument
-		virtual void siftDown( Handle& ) = 0 ;
-
-		// create a new handle at the 'right' position and return its handle
-		virtual Handle& createNew( const dataType& ) = 0 ;
-
-		// return the handle of the first or 'highest priority' element
-		virtual Handle& first() = 0 ;
-
-		// mode the last element to become the first, needed for pop
-		virtual void moveLastToFirst() = 0 ;
-
-		// delete the last element's handle
-		virtual void deleteLast() = 0 ;
-
-		// returns a reference to the handle where the value is actually stored
-		virtual Handle& index( const Handle& ) const = 0 ;
-		
-		// returns a reference to the handle that stores a dataType with the same value as the parameter
-	  virtual Handle& value( const dataType& ) const = 0 ;
-	  
   public:
 		// HEAP INTERFACE
 
-		// NOTE: THE COPY CONSTRUCTOR AND THE ASSIGNMENT OPERATOR ARE NOT IMPLEMENTED 
-		//       BECAUSE THERE ARE NO POINTER OR RESOURCE TYPE INSTANCE VARIABLES.  
-		//       THIS MAY NOT BE THE CASE FOR SUBCLASSES OF HEAP, WHICH PROBABLY HAVE TO IMPLEMENT THEM
-
-		// constructor with ordering function and the order
-		Heap( compareFxn, order );
-
 		// so the right version of the destructor gets called in the subclasses
 		virtual ~Heap();
 
@@ -176,19 +153,31 @@ class Heap
 		virtual const dataType& top() const = 0 ;
 
 		// remove the highest priority element
-		virtual void pop();
+		virtual void pop() = 0 ;
 
 		// insert a new element and return its handle
-		virtual Handle& push( const dataType& );
+		virtual Handle& push( const dataType& ) = 0 ;
+
+		// insert a new element by moving it into the heap
+		virtual Handle& push( dataType&& ) = 0 ;
+
+		// remove the highest priority element and return it
+		virtual dataType popValue() = 0 ;
+
+		// remove the element with handle
+		virtual void erase( Handle& ) = 0 ;
 
 		// change the position of the element with handle because its priority has changed
-		virtual void priorityChange( Handle& );
+		virtual void priorityChange( Handle& ) = 0 ;
+
+		// move all the elements of the argument into this heap -- by default one by one
+		virtual void merge( Heap<dataType>& );
 
 		// true iff heap is empty
-		bool vide() const ;
+		virtual bool vide() const = 0 ;
 
 		// number of elements in the heap
-		int size() const ;
+		virtual int size() const = 0 ;
 };
 
 #endif // MHS_CODEBLOCKS_CPP_HEAP_HEAP_HPP
@@ -0,0 +1,67 @@
+/*
+ * HeapAdapter.cpp
+ *   Created on: Oct 18, 2026
+ */
+
+#include "HeapAdapter.hpp"
+
+// impl(): the wrapped heap
+template<typename Impl>
+Impl& HeapAdapter<Impl>::impl()
+{ return heap ; }
+
+// top()
+template<typename Impl>
+const typename Impl::value_type& HeapAdapter<Impl>::top() const
+{ return heap.top(); }
+
+// pop()
+template<typename Impl>
+void HeapAdapter<Impl>::pop()
+{ heap.pop(); }
+
+// push()
+template<typename Impl>
+typename Heap<typename Impl::value_type>::Handle& HeapAdapter<Impl>::push( const dataType& e )
+{ return heap.push( e ); }
+
+// push(): moving the element in
+template<typename Impl>
+typename Heap<typename Impl::value_type>::Handle& HeapAdapter<Impl>::push( dataType&& e )
+{ return heap.push( std::move(e) ); }
+
+// popValue()
+template<typename Impl>
+typename Impl::value_type HeapAdapter<Impl>::popValue()
+{ return heap.popValue(); }
+
+// erase()
+template<typename Impl>
+void HeapAdapter<Impl>::erase( typename Heap<dataType>::Handle& h )
+{ heap.erase( h ); }
+
+// priorityChange()
+template<typename Impl>
+void HeapAdapter<Impl>::priorityChange( typename Heap<dataType>::Handle& h )
+{ heap.priorityChange( h ); }
+
+// merge(): with the merge() of Impl when the other heap is wrapping the same implementation
+template<typename Impl>
+void HeapAdapter<Impl>::merge( Heap<dataType>& h )
+{
+	HeapAdapter<Impl>* other = dynamic_cast<HeapAdapter<Impl>*>( &h );
+	if( other )
+	  heap.merge( other->heap );
+	else
+	    Heap<dataType>::merge( h );
+}
+
+// vide()
+template<typename Impl>
+bool HeapAdapter<Impl>::vide() const
+{ return heap.vide(); }
+
+// size()
+template<typename Impl>
+int HeapAdapter<Impl>::size() const
+{ return heap.size(); }
@@ -0,0 +1,74 @@
+/*
+ * HeapAdapter.hpp
+ *   Created on: Oct 18, 2026
+ */
+
+#ifndef MHS_CODEBLOCKS_CPP_HEAP_HEAPADAPTER_HPP
+#define MHS_CODEBLOCKS_CPP_HEAP_HEAPADAPTER_HPP
+
+#include <utility>
+#include <type_traits>
+#include "Heap.hpp"
+
+/***
+  **  HeapAdapter class
+  **
+  **    - Subclass of Heap<dataType>
+  **    - makes a statically dispatched heap (ArrayHeap, LinkHeap, ...) usable through the
+  **      runtime-polymorphic Heap<dataType> interface, e.g.
+  **
+  **        HeapAdapter< ArrayHeap<TestType> > a( lt, Heap<TestType>::SMALLER_FIRST );
+  **        Heap<TestType>& h = a ;
+  **
+  **    - each Heap operation costs ONE virtual call; inside it everything is dispatched statically
+  **
+  **    OPERATIONS:
+  **
+  **    -  Impl& impl();
+  **         the wrapped heap, for the operations that are not part of Heap<dataType>
+  **
+  ***/
+template<typename Impl>
+class HeapAdapter : public Heap<typename Impl::value_type>
+{
+ private:
+	typedef typename Impl::value_type dataType ;
+
+	// the wrapped heap
+	Impl heap ;
+
+	// true for one argument that is a HeapAdapter -- or derived from one -- which is copied or moved, not passed on
+	template<typename... Args>
+	struct IsAdapter : std::false_type {};
+	template<typename Arg>
+	struct IsAdapter<Arg> : std::is_base_of< HeapAdapter<Impl>, typename std::decay<Arg>::type > {};
+
+ public:
+	// CONSTRUCTOR: the arguments are passed on to the constructor of Impl
+	template<typename... Args, typename = typename std::enable_if< !IsAdapter<Args...>::value >::type>
+	HeapAdapter( Args&&... args ) : heap( std::forward<Args>(args)... ) {}
+
+	// copy and move the wrapped heap
+	HeapAdapter( const HeapAdapter<Impl>& ) = default ;
+	HeapAdapter( HeapAdapter<Impl>&& ) = default ;
+	HeapAdapter<Impl>& operator=( const HeapAdapter<Impl>& ) = default ;
+	HeapAdapter<Impl>& operator=( HeapAdapter<Impl>&& ) = default ;
+
+	// the wrapped heap
+	Impl& impl();
+
+	// Heap<dataType> interface
+	const dataType& top() const ;
+	void pop();
+	typename Heap<dataType>::Handle& push( const dataType& );
+	typename Heap<dataType>::Handle& push( dataType&& );
+	dataType popValue();
+	void erase( typename Heap<dataType>::Handle& );
+	void priorityChange( typename Heap<dataType>::Handle& );
+	void merge( Heap<dataType>& );
+	bool vide() const ;
+	int size() const ;
+
+};// class HeapAdapter
+
+#endif // MHS_CODEBLOCKS_CPP_HEAP_HEAPADAPTER_HPP
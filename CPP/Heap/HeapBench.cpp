@@ -0,0 +1,395 @@
+/*
+ * HeapBench.cpp
+ *   Created on: Oct 18, 2026
+ *
+ *   ns per operation of the heaps against std::priority_queue, to follow the performance from one version to the next
+ *     - heaps: ArrayHeap (2-ary and 4-ary), IntegerHeap (8-ary, with the vector instructions this CPU has -- integer8_avx2 or
+ *       integer8_sse4 -- and without them, integer8_scalar), LinkHeap, PairingHeap, LeftistHeap, std::priority_queue
+ *       and BucketQueue for the keys with only 16 different values
+ *     - keys: uniform random, sorted, reverse sorted, or only 16 different values
+ *     - sizes: 1e3, 1e4, ... up to max_size
+ *     - operations, each on a heap of 'size' elements, 'size' times:
+ *         push            build the heap
+ *         top             read the top
+ *         priorityChange  give a random element a new key -- not for std::priority_queue, which has no handles
+ *         mixed           pop the top and push a new key ('hold' model: the size stays the same) -- one pop + one push per op
+ *         pop             empty the heap
+ *         pushMany        fill it again with one pushMany() -- appended and heapified
+ *         popMany         empty it with one popMany()
+ *         merge           merge() a heap of size/2 elements into another one of size/2 -- per element of the result
+ *       the last three not for std::priority_queue, which has none of them
+ *     - the best of up to 20 runs for the sizes below a million, to smooth out the noise of the short ones
+ *   'arity' runs only ArrayHeap with 2, 4, 8 and 16 children per node, with uniform keys, on 8-byte keys (k8)
+ *   and on 64-byte records with an 8-byte key (k64): 'size' pushes, then 'size' pops
+ *   'layout' runs only IntegerHeap with 2, 4 and 8 children per node, in the flat and the paged layouts of
+ *   Layout.hpp, with uniform and sorted keys -- e.g. 'HeapBench layout 10000000 10000000' for 10M elements
+ *
+ *   usage: HeapBench [ csv | json ] [ arity | layout ] [ max_size [ min_size ] ]
+ *   prints CSV: heap,keys,size,operation,ns_per_op -- or the same fields as a JSON array
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <chrono>
+#include <functional>
+#include <queue>
+#include <string>
+#include <vector>
+
+// the templates are compiled here for 'long' -- see Instance.cpp
+#include "Heap.cpp"
+#include "StaticHeap.cpp"
+#include "Slab.cpp"
+#include "ArrayHeap.cpp"
+#include "LinkHeap.cpp"
+#include "PairingHeap.cpp"
+#include "LeftistHeap.cpp"
+#include "KeyedHeap.cpp"
+#include "IntegerHeap.cpp"
+#include "BucketQueue.cpp"
+
+typedef StaticPriority<long> LongPriority ;
+typedef Heap<long>::Handle* Ref ;
+
+// smallest first, like the heaps with LongPriority
+typedef std::priority_queue< long, std::vector<long>, std::greater<long> > StdQueue ;
+
+// the same IntegerHeap without the vector instructions
+struct ScalarIntegerHeap : public IntegerHeap<long, 8>
+{ ScalarIntegerHeap() : IntegerHeap<long, 8>( false ) {} };
+
+// a 64-byte record with an 8-byte key
+struct Record64
+{
+  long key ;
+  long payload[7] ;
+  Record64( long k = 0 ) : key( k ) {}
+  bool operator<( const Record64& r ) const { return key < r.key ; }
+};
+
+// the key of the elements measured
+inline long keyOf( long k ) { return k ; }
+inline long keyOf( const Record64& r ) { return r.key ; }
+
+// the operations measured, on any of the heaps
+template<typename H>
+struct Ops
+{
+  static const bool handles = true ;
+  static Ref push( H& h, long k ) { return &h.push( k ); }
+  static void pop( H& h ) { h.pop(); }
+  static long top( const H& h ) { return h.top(); }
+  static void change( H& h, Ref r, long k ) { h.priorityChange( *r, k ); }
+
+  static const bool bulk = true ;
+  static void pushMany( H& h, const long* begin, const long* end ) { h.pushMany( begin, end ); }
+  static void popMany( H& h, int k, long* out ) { h.popMany( k, out ); }
+  static void merge( H& h, H& other ) { h.merge( other ); }
+};
+
+// std::priority_queue has no handles, so no priorityChange()
+template<>
+struct Ops<StdQueue>
+{
+  static const bool handles = false ;
+  static Ref push( StdQueue& h, long k ) { h.push( k ); return 0 ; }
+  static void pop( StdQueue& h ) { h.pop(); }
+  static long top( const StdQueue& h ) { return h.top(); }
+  static void change( StdQueue&, Ref, long ) {}
+
+  static const bool bulk = false ;
+  static void pushMany( StdQueue&, const long*, const long* ) {}
+  static void popMany( StdQueue&, int, long* ) {}
+  static void merge( StdQueue&, StdQueue& ) {}
+};
+
+// the key distributions
+enum Keys { UNIFORM, SORTED, REVERSE, DUPLICATES, NUM_KEYS };
+const char* keyName[ NUM_KEYS ] = { "uniform", "sorted", "reverse", "duplicates" };
+
+// the operations, in the order they are run on one heap
+enum Operation { PUSH, TOP, CHANGE, MIXED, POP, PUSH_MANY, POP_MANY, MERGE, NUM_OPS };
+const char* opName[ NUM_OPS ] = { "push", "top", "priorityChange", "mixed", "pop", "pushMany", "popMany", "merge" };
+
+// the name of the IntegerHeap<long, 8> rows, by the instructions it picks the children with -- see Select.hpp
+const char* integer8Name[] = { "integer8_scalar", "integer8_sse4", "integer8_avx2" };
+
+// a reproducible random number
+unsigned int randomNumber( unsigned int& x )
+{
+  x ^= x << 13 ;
+  x ^= x >> 17 ;
+  x ^= x << 5 ;
+  return x ;
+}
+
+// 2n keys of a distribution: the first n are pushed, the others are the new keys of priorityChange and mixed
+std::vector<long> makeKeys( Keys keys, int n )
+{
+  std::vector<long> k( 2 * n );
+  unsigned int x = 2463534242u ;
+  for( int i = 0 ; i < 2 * n ; i++ )
+    switch( keys )
+    {
+      case UNIFORM:    k[i] = randomNumber( x ) & 0x7fffffff ; break ;
+      case SORTED:     k[i] = i ; break ;
+      case REVERSE:    k[i] = 2 * n - i ; break ;
+      case DUPLICATES: k[i] = randomNumber( x ) % 16 ; break ;
+      default:         break ;
+    }
+  return k ;
+}
+
+// keep the compiler from moving the reads of the heap out of a loop
+inline void clobber()
+{ asm volatile( "" : : : "memory" ); }
+
+// the time since 'start', in ns
+double since( std::chrono::steady_clock::time_point start )
+{ return std::chrono::duration<double, std::nano>( std::chrono::steady_clock::now() - start ).count(); }
+
+// one run of all the operations on a heap of n elements -- ns[op] is the time per operation
+template<typename H>
+void runOnce( const std::vector<long>& keys, int n, double ns[] )
+{
+  H h ;
+  std::vector<Ref> refs( n );
+  unsigned int x = 88172645u ;
+  volatile long sink = 0 ;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for( int i = 0 ; i < n ; i++ )
+    refs[i] = Ops<H>::push( h, keys[i] );
+  ns[PUSH] = since( start ) / n ;
+
+  long sum = 0 ;
+  start = std::chrono::steady_clock::now();
+  for( int i = 0 ; i < n ; i++ )
+  {
+    sum += Ops<H>::top( h );
+    clobber();
+  }
+  ns[TOP] = since( start ) / n ;
+  sink = sum ;
+
+  // every handle is still valid: nothing has been popped yet
+  ns[CHANGE] = 0 ;
+  if( Ops<H>::handles )
+  {
+    std::vector<int> which( n );
+    for( int i = 0 ; i < n ; i++ )
+      which[i] = randomNumber( x ) % n ;
+    start = std::chrono::steady_clock::now();
+    for( int i = 0 ; i < n ; i++ )
+      Ops<H>::change( h, refs[ which[i] ], keys[n + i] );
+    ns[CHANGE] = since( start ) / n ;
+  }
+
+  start = std::chrono::steady_clock::now();
+  for( int i = 0 ; i < n ; i++ )
+  {
+    sum += Ops<H>::top( h );
+    Ops<H>::pop( h );
+    Ops<H>::push( h, keys[n + i] );
+  }
+  ns[MIXED] = since( start ) / n ;
+
+  start = std::chrono::steady_clock::now();
+  for( int i = 0 ; i < n ; i++ )
+  {
+    sum += Ops<H>::top( h );
+    Ops<H>::pop( h );
+  }
+  ns[POP] = since( start ) / n ;
+  sink = sum ;
+
+  ns[PUSH_MANY] = ns[POP_MANY] = ns[MERGE] = 0 ;
+  if( Ops<H>::bulk )
+  {
+    start = std::chrono::steady_clock::now();
+    Ops<H>::pushMany( h, &keys[0], &keys[0] + n );
+    ns[PUSH_MANY] = since( start ) / n ;
+
+    std::vector<long> out( n );
+    start = std::chrono::steady_clock::now();
+    Ops<H>::popMany( h, n, &out[0] );
+    ns[POP_MANY] = since( start ) / n ;
+    sink = out[n - 1] ;
+
+    H other ;
+    Ops<H>::pushMany( h, &keys[0], &keys[0] + n / 2 );
+    Ops<H>::pushMany( other, &keys[0] + n / 2, &keys[0] + n );
+    start = std::chrono::steady_clock::now();
+    Ops<H>::merge( h, other );
+    ns[MERGE] = since( start ) / n ;
+  }
+  (void)sink ;
+}
+
+// n pushes, then n pops -- only ns[PUSH] and ns[POP] are set
+template<typename H>
+void runPushPop( const std::vector<long>& keys, int n, double ns[] )
+{
+  H h ;
+  volatile long sink = 0 ;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for( int i = 0 ; i < n ; i++ )
+    h.push( typename H::value_type( keys[i] ) );
+  ns[PUSH] = since( start ) / n ;
+
+  long sum = 0 ;
+  start = std::chrono::steady_clock::now();
+  for( int i = 0 ; i < n ; i++ )
+  {
+    sum += keyOf( h.top() );
+    h.pop();
+  }
+  ns[POP] = since( start ) / n ;
+  sink = sum ;
+  (void)sink ;
+}
+
+// print one result
+void report( bool json, bool& first, const char* heap, Keys keys, int n, Operation op, double ns )
+{
+  if( json )
+  {
+    cout << ( first ? "[\n" : ",\n" ) << "  { \"heap\": \"" << heap << "\", \"keys\": \"" << keyName[keys]
+         << "\", \"size\": " << n << ", \"operation\": \"" << opName[op] << "\", \"ns_per_op\": " << ns << " }" ;
+  }
+  else
+  {
+    if( first )
+      cout << "heap,keys,size,operation,ns_per_op\n" ;
+    cout << heap << ',' << keyName[keys] << ',' << n << ',' << opName[op] << ',' << ns << '\n' ;
+  }
+  first = false ;
+}
+
+// the best of up to 20 runs -- fewer as the heap gets bigger
+template<typename H>
+void run( bool json, bool& first, const char* heap, Keys keys, int n, const std::vector<long>& k )
+{
+  int runs = n < 1000000 ? 1000000 / n : 1 ;
+  if( runs > 20 )
+    runs = 20 ;
+
+  double best[ NUM_OPS ], ns[ NUM_OPS ];
+  for( int r = 0 ; r < runs ; r++ )
+  {
+    runOnce<H>( k, n, ns );
+    for( int op = 0 ; op < NUM_OPS ; op++ )
+      if( r == 0 || ns[op] < best[op] )
+        best[op] = ns[op] ;
+  }
+
+  for( int op = 0 ; op < NUM_OPS ; op++ )
+    if( ( op != CHANGE || Ops<H>::handles ) && ( op < PUSH_MANY || Ops<H>::bulk ) )
+      report( json, first, heap, keys, n, Operation(op), best[op] );
+  cout.flush();
+}
+
+// the best of up to 20 runs of runPushPop()
+template<typename H>
+void runArity( bool json, bool& first, const char* heap, int n, const std::vector<long>& k )
+{
+  int runs = n < 1000000 ? 1000000 / n : 1 ;
+  if( runs > 20 )
+    runs = 20 ;
+
+  double best[ NUM_OPS ] = { 0 }, ns[ NUM_OPS ] = { 0 };
+  for( int r = 0 ; r < runs ; r++ )
+  {
+    runPushPop<H>( k, n, ns );
+    if( r == 0 || ns[PUSH] < best[PUSH] )
+      best[PUSH] = ns[PUSH] ;
+    if( r == 0 || ns[POP] < best[POP] )
+      best[POP] = ns[POP] ;
+  }
+
+  report( json, first, heap, UNIFORM, n, PUSH, best[PUSH] );
+  report( json, first, heap, UNIFORM, n, POP, best[POP] );
+  cout.flush();
+}
+
+// the arity table: ArrayHeap of 2 to 16 children per node, on small and big elements
+void arityTable( bool json, bool& first, int minSize, int maxSize )
+{
+  typedef StaticPriority<Record64> RecordPriority ;
+  for( int n = minSize ; n <= maxSize ; n *= 10 )
+  {
+    std::vector<long> k = makeKeys( UNIFORM, n );
+    runArity< ArrayHeap<long, 2, LongPriority> >( json, first, "array2_k8", n, k );
+    runArity< ArrayHeap<long, 4, LongPriority> >( json, first, "array4_k8", n, k );
+    runArity< ArrayHeap<long, 8, LongPriority> >( json, first, "array8_k8", n, k );
+    runArity< ArrayHeap<long, 16, LongPriority> >( json, first, "array16_k8", n, k );
+    runArity< ArrayHeap<Record64, 2, RecordPriority> >( json, first, "array2_k64", n, k );
+    runArity< ArrayHeap<Record64, 4, RecordPriority> >( json, first, "array4_k64", n, k );
+    runArity< ArrayHeap<Record64, 8, RecordPriority> >( json, first, "array8_k64", n, k );
+    runArity< ArrayHeap<Record64, 16, RecordPriority> >( json, first, "array16_k64", n, k );
+  }
+}
+
+// the layout table: IntegerHeap of 2, 4 and 8 children per node, flat and paged
+void layoutTable( bool json, bool& first, int minSize, int maxSize )
+{
+  typedef PagedLayout<2> Paged2 ;
+  typedef PagedLayout<4> Paged4 ;
+  typedef PagedLayout<8> Paged8 ;
+  for( int n = minSize ; n <= maxSize ; n *= 10 )
+    for( int keys = UNIFORM ; keys <= SORTED ; keys++ )
+    {
+      std::vector<long> k = makeKeys( Keys(keys), n );
+      run< IntegerHeap<long, 8> >( json, first, "integer8_flat", Keys(keys), n, k );
+      run< IntegerHeap<long, 8, Heap<long>::SMALLER_FIRST, NoHooks, Paged8> >( json, first, "integer8_paged", Keys(keys), n, k );
+      run< IntegerHeap<long, 4> >( json, first, "integer4_flat", Keys(keys), n, k );
+      run< IntegerHeap<long, 4, Heap<long>::SMALLER_FIRST, NoHooks, Paged4> >( json, first, "integer4_paged", Keys(keys), n, k );
+      run< IntegerHeap<long, 2> >( json, first, "integer2_flat", Keys(keys), n, k );
+      run< IntegerHeap<long, 2, Heap<long>::SMALLER_FIRST, NoHooks, Paged2> >( json, first, "integer2_paged", Keys(keys), n, k );
+    }
+}
+
+int main( int argc, char* argv[] )
+{
+  bool json = false ;
+  int arg = 1 ;
+  if( arg < argc && ( strcmp(argv[arg], "json") == 0 || strcmp(argv[arg], "csv") == 0 ) )
+    json = strcmp( argv[arg++], "json" ) == 0 ;
+  bool arity = arg < argc && strcmp( argv[arg], "arity" ) == 0 ;
+  bool layout = arg < argc && strcmp( argv[arg], "layout" ) == 0 ;
+  if( arity || layout )
+    arg++ ;
+  int maxSize = arg < argc ? atoi( argv[arg++] ) : 10000000 ;
+  int minSize = arg < argc ? atoi( argv[arg++] ) : 1000 ;
+
+  bool first = true ;
+  if( arity )
+    arityTable( json, first, minSize, maxSize );
+  else if( layout )
+    layoutTable( json, first, minSize, maxSize );
+  else
+  for( int n = minSize ; n <= maxSize ; n *= 10 )
+    for( int keys = 0 ; keys < NUM_KEYS ; keys++ )
+    {
+      std::vector<long> k = makeKeys( Keys(keys), n );
+      run< ArrayHeap<long, 2, LongPriority> >( json, first, "array2", Keys(keys), n, k );
+      run< ArrayHeap<long, 4, LongPriority> >( json, first, "array4", Keys(keys), n, k );
+      // no vector row where the CPU has none: it would be the scalar one again
+      SelectTier tier = IntegerHeap<long, 8>().selectTier();
+      if( tier != SCALAR_TIER )
+        run< IntegerHeap<long, 8> >( json, first, integer8Name[tier], Keys(keys), n, k );
+      run< ScalarIntegerHeap >( json, first, integer8Name[SCALAR_TIER], Keys(keys), n, k );
+      run< LinkHeap<long, LongPriority> >( json, first, "link", Keys(keys), n, k );
+      run< PairingHeap<long, LongPriority> >( json, first, "pairing", Keys(keys), n, k );
+      run< LeftistHeap<long, LongPriority> >( json, first, "leftist", Keys(keys), n, k );
+      run< StdQueue >( json, first, "std_priority_queue", Keys(keys), n, k );
+      if( keys == DUPLICATES )
+        run< BucketQueue<long> >( json, first, "bucket", Keys(keys), n, k );
+    }
+
+  if( json )
+    cout << ( first ? "[]\n" : "\n]\n" );
+  return 0 ;
+}
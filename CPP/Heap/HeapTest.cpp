@@ -0,0 +1,256 @@
+/*
+ * HeapTest.cpp
+ *   Created on: Oct 18, 2026
+ *
+ *   checks of the heaps that Main.cpp does not make, meant to be built with -fsanitize=address,undefined -- see the
+ *   HeapTest target
+ *     - copies: an element that counts its copies goes in with push( dataType&& ), emplace() and a range of
+ *       move_iterators, and out with popValue() and popMany(), without being copied once
+ *     - merge order: after merge(), the equal elements of the other heap come out behind ours, in their own order
+ *       -- for every heap and every way its merge() can go, by size and by Priority
+ *     - melds: LeftistHeap and PairingHeap merges, of the same order or of opposite ones, give the same elements
+ *       in the same order as a std::priority_queue of all of them
+ *
+ *   usage: HeapTest
+ *   prints one line per check: heap,check,OK|FAILED -- and returns the number of checks FAILED
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <queue>
+#include <vector>
+
+// the templates are compiled here for the elements of the checks -- see Instance.cpp
+#include "Heap.cpp"
+#include "StaticHeap.cpp"
+#include "Slab.cpp"
+#include "ArrayHeap.cpp"
+#include "LinkHeap.cpp"
+#include "PairingHeap.cpp"
+#include "LeftistHeap.cpp"
+#include "KeyedHeap.cpp"
+
+// print the result of a check, and count it if it FAILED
+int report( const char* heap, const char* check, bool ok )
+{
+  cout << heap << ',' << check << ',' << ( ok ? "OK" : "FAILED" ) << endl;
+  return ok ? 0 : 1 ;
+}
+
+// an element that counts how many times any of them was copied -- moves are free
+struct Counted
+{
+  static long copies ;
+
+  long key ;
+  std::vector<long> payload ;
+
+  Counted( long k = 0 ) : key( k ), payload( 4, k ) {}
+  Counted( const Counted& c ) : key( c.key ), payload( c.payload ) { ++copies ; }
+  Counted( Counted&& c ) : key( c.key ), payload( std::move(c.payload) ) {}
+  Counted& operator=( const Counted& c ) { key = c.key ; payload = c.payload ; ++copies ; return *this ; }
+  Counted& operator=( Counted&& c ) { key = c.key ; payload = std::move( c.payload ); return *this ; }
+
+  bool operator<( const Counted& c ) const { return key < c.key ; }
+};
+long Counted::copies = 0 ;
+
+typedef StaticPriority<Counted> CountedPriority ;
+
+// a reproducible random number
+long randomNumber( unsigned int& x )
+{
+  x ^= x << 13 ;
+  x ^= x >> 17 ;
+  x ^= x << 5 ;
+  return x % 1000 ;
+}
+
+// push, emplace, popValue, popMany and the range constructor of one kind of heap, without a copy
+template<typename H>
+int copies( const char* heap )
+{
+  const int N = 2000 ;
+  unsigned int x = 2463534242u ;
+  int failed = 0 ;
+
+  {
+    H h ;
+    Counted::copies = 0 ;
+    for( int i = 0 ; i < N ; i++ )
+    {
+      Counted c( randomNumber(x) );
+      h.push( std::move(c) );
+    }
+    failed += report( heap, "push_move_no_copy", Counted::copies == 0 );
+
+    Counted::copies = 0 ;
+    for( int i = 0 ; i < N ; i++ )
+      h.emplace( randomNumber(x) );
+    failed += report( heap, "emplace_no_copy", Counted::copies == 0 );
+
+    Counted::copies = 0 ;
+    bool inOrder = true ;
+    long last = -1 ;
+    for( int i = 0 ; i < N ; i++ )
+    {
+      Counted c = h.popValue();
+      inOrder = inOrder && c.key >= last && c.payload.size() == 4 ;
+      last = c.key ;
+    }
+    failed += report( heap, "popValue_no_copy", Counted::copies == 0 && inOrder );
+
+    std::vector<Counted> out ;
+    out.reserve( N );
+    Counted::copies = 0 ;
+    h.popMany( N, std::back_inserter(out) );
+    inOrder = (int)out.size() == N && h.vide() ;
+    for( int i = 1 ; i < (int)out.size() ; i++ )
+      inOrder = inOrder && out[i - 1].key <= out[i].key ;
+    failed += report( heap, "popMany_no_copy", Counted::copies == 0 && inOrder );
+  }
+
+  std::vector<Counted> in ;
+  for( int i = 0 ; i < N ; i++ )
+    in.push_back( Counted(randomNumber(x)) );
+  Counted::copies = 0 ;
+  H h( std::make_move_iterator(in.begin()), std::make_move_iterator(in.end()) );
+  failed += report( heap, "move_range_no_copy", Counted::copies == 0 && h.size() == N );
+
+  return failed ;
+}
+
+// an element with few different keys, and the order it was pushed in
+struct Tagged
+{
+  long key ;
+  int tag ;
+};
+
+bool taggedLess( const Tagged& a, const Tagged& b ) { return a.key < b.key ; }
+struct TaggedLess { bool operator()( const Tagged& a, const Tagged& b ) const { return a.key < b.key ; } };
+struct TaggedKey { long operator()( const Tagged& t ) const { return t.key ; } };
+
+typedef StaticPriority<Tagged, TaggedLess> TaggedPriority ;
+
+// a heap of each size with free slots, merged into a heap of each other size -- then every element comes out,
+// smallest key first, and the equal ones in the order they were pushed: the other heap pushed them after ours
+template<typename H>
+int mergeOrder( const char* heap, const H& ours, const H& theirs )
+{
+  const int SIZES[] = { 0, 1, 10, 100, 1000 };
+  const int NUM_SIZES = sizeof(SIZES) / sizeof(SIZES[0]) ;
+  unsigned int x = 88172645u ;
+  bool ok = true ;
+
+  for( int i = 0 ; i < NUM_SIZES ; i++ )
+    for( int j = 0 ; j < NUM_SIZES ; j++ )
+    {
+      H a( ours ), b( theirs );
+      int tag = 0 ;
+      for( int k = 0 ; k < SIZES[i] + SIZES[i] / 4 ; k++ )
+      {
+        Tagged t = { randomNumber(x) % 8, tag++ };
+        a.push( t );
+      }
+      for( int k = 0 ; k < SIZES[i] / 4 ; k++ )
+        a.pop();
+      for( int k = 0 ; k < SIZES[j] + SIZES[j] / 4 ; k++ )
+      {
+        Tagged t = { randomNumber(x) % 8, tag++ };
+        b.push( t );
+      }
+      for( int k = 0 ; k < SIZES[j] / 4 ; k++ )
+        b.pop();
+
+      a.merge( b );
+      ok = ok && b.vide() && a.size() == SIZES[i] + SIZES[j] ;
+
+      Tagged last = { -1, -1 };
+      while( !a.vide() )
+      {
+        Tagged t = a.popValue();
+        ok = ok && ( t.key > last.key || ( t.key == last.key && t.tag > last.tag ) );
+        last = t ;
+      }
+    }
+
+  return report( heap, "merge_tie_order", ok );
+}
+
+bool longLess( const long& a, const long& b ) { return a < b ; }
+
+// random heaps melded, or merged from the opposite order, against a std::priority_queue of all their elements
+template<typename H>
+int meldReference( const char* heap )
+{
+  typedef std::priority_queue< long, std::vector<long>, std::greater<long> > Reference ;
+  unsigned int x = 2463534242u ;
+  bool same = true, opposite = true ;
+
+  for( int round = 0 ; round < 200 ; round++ )
+  {
+    H a( longLess, Heap<long>::SMALLER_FIRST ), b( longLess, Heap<long>::SMALLER_FIRST ), c( longLess, Heap<long>::LARGER_FIRST );
+    Reference ab, ac ;
+    int n = randomNumber( x ), m = round % 4 ? randomNumber( x ) : randomNumber( x ) % 4 ;
+    for( int k = 0 ; k < n ; k++ )
+    {
+      long v = randomNumber( x );
+      a.push( v );
+      ab.push( v );
+    }
+    for( int k = 0 ; k < n / 3 ; k++ )
+    {
+      a.pop();
+      ab.pop();
+    }
+    H d( a );
+    ac = ab ;
+    for( int k = 0 ; k < m ; k++ )
+    {
+      long v = randomNumber( x );
+      b.push( v );
+      c.push( v );
+      ab.push( v );
+      ac.push( v );
+    }
+
+    a.merge( b );
+    d.merge( c );
+    same = same && b.vide() && a.size() == (int)ab.size() ;
+    opposite = opposite && c.vide() && d.size() == (int)ac.size() ;
+    for( ; !ab.empty() ; ab.pop() )
+      same = same && a.popValue() == ab.top() ;
+    for( ; !ac.empty() ; ac.pop() )
+      opposite = opposite && d.popValue() == ac.top() ;
+  }
+
+  return report( heap, "meld_same_order", same )
+       + report( heap, "merge_opposite_order", opposite );
+}
+
+int main()
+{
+  cout << "heap,check,result" << endl;
+
+  int failed = 0 ;
+  failed += copies< ArrayHeap<Counted, 2, CountedPriority> >( "array2" );
+  failed += copies< ArrayHeap<Counted, 4, CountedPriority> >( "array4" );
+  failed += copies< LinkHeap<Counted, CountedPriority> >( "link" );
+  failed += copies< PairingHeap<Counted, CountedPriority> >( "pairing" );
+  failed += copies< LeftistHeap<Counted, CountedPriority> >( "leftist" );
+
+  failed += mergeOrder( "array2", ArrayHeap<Tagged, 2, TaggedPriority>(), ArrayHeap<Tagged, 2, TaggedPriority>() );
+  failed += mergeOrder( "link", LinkHeap<Tagged, TaggedPriority>(), LinkHeap<Tagged, TaggedPriority>() );
+  failed += mergeOrder( "pairing", PairingHeap<Tagged, TaggedPriority>(), PairingHeap<Tagged, TaggedPriority>() );
+  failed += mergeOrder( "pairing_runtime", PairingHeap<Tagged>( taggedLess, Heap<Tagged>::SMALLER_FIRST ),
+                        PairingHeap<Tagged>( taggedLess, Heap<Tagged>::LARGER_FIRST ) );
+  failed += mergeOrder( "leftist_runtime", LeftistHeap<Tagged>( taggedLess, Heap<Tagged>::SMALLER_FIRST ),
+                        LeftistHeap<Tagged>( taggedLess, Heap<Tagged>::LARGER_FIRST ) );
+  failed += mergeOrder( "keyed4", KeyedHeap<Tagged, TaggedKey, 4>(), KeyedHeap<Tagged, TaggedKey, 4>() );
+
+  failed += meldReference< LeftistHeap<long> >( "leftist" );
+  failed += meldReference< PairingHeap<long> >( "pairing" );
+  return failed ;
+}
@@ -0,0 +1,161 @@
+/*
+ * Hooks.hpp
+ *   Created on: Oct 18, 2026
+ */
+
+#ifndef MHS_CODEBLOCKS_CPP_HEAP_HOOKS_HPP
+#define MHS_CODEBLOCKS_CPP_HEAP_HOOKS_HPP
+
+#include <iostream>
+#include <iomanip>
+
+/***
+  **  HOOKS classes
+  **
+  **    a heap holds ONE Hooks object and tells it about the events below -- the heaps themselves never do any I/O
+  **    e.g. ArrayHeap< Job, 4, JobPriority, LogHooks > logs, ArrayHeap< Job, 4, JobPriority > does not
+  **
+  **    OPERATIONS:
+  **
+  **    -  void created( const char* heap, int size );
+  **         a heap of that kind has been constructed, with 'size' elements
+  **
+  **    -  void destroyed( const char* heap, int size );
+  **         a heap of that kind is being destroyed, with 'size' elements still in it
+  **
+  **    -  void compared();
+  **         the heap asked its Priority object which of two elements comes first
+  **
+  **    -  void swapped();
+  **         two elements exchanged their places in the heap
+  **
+  **    -  void sifted( SiftDirection, int levels, int nodes );
+  **         a siftUp() or siftDown() is over: the element moved 'levels' levels, and 'nodes' nodes were read
+  **         on the way, itself included -- only the heaps that sift (ArrayHeap, LinkHeap, IntegerHeap, KeyedHeap)
+  **         report it, PairingHeap and LeftistHeap meld instead and RadixHeap moves elements between buckets,
+  **         and they only report their comparisons
+  **
+  **    a Hooks class that derives from NoHooks only has to define the events it cares about
+  **    a heap copied or assigned from another one takes a copy of its Hooks object too, with what it has recorded
+  **
+  ***/
+
+// the two kinds of sift -- see sifted()
+enum SiftDirection { SIFT_UP, SIFT_DOWN };
+
+/**
+  *  NoHooks class
+  *    - the default: every hook is an empty inline function, so the calls compile to nothing
+  */
+class NoHooks
+{
+ public:
+	void created( const char*, int ) {}
+	void destroyed( const char*, int ) {}
+	void compared() {}
+	void swapped() {}
+	void sifted( SiftDirection, int, int ) {}
+};
+/* class NoHooks */
+
+/**
+  *  LogHooks class
+  *    - writes one line per event to a stream, std::clog by default
+  *    - with '\n' rather than endl, so the stream is not flushed every time
+  */
+class LogHooks : public NoHooks
+{
+ private:
+	std::ostream* os ;
+
+ public:
+	LogHooks( std::ostream& o = std::clog ) : os( &o ) {}
+
+	void created( const char* heap, int size )
+	{ *os << heap << " created with " << size << " elements.\n" ; }
+
+	void destroyed( const char* heap, int size )
+	{ *os << heap << " DESTRUCTOR called with " << size << " elements.\n" ; }
+};
+/* class LogHooks */
+
+/**
+  *  CountingHooks class
+  *    - counts the comparisons, the swaps, and the sifts with the nodes they read,
+  *      and keeps a histogram of how many levels each sift moved its element
+  *    - e.g. to see whether a queue would do better with another arity, Priority or heap:
+  *
+  *        ArrayHeap< Job, 4, JobPriority, CountingHooks > h ;
+  *        ...
+  *        h.instrumentation().print( cerr );
+  *
+  *    - a sift of MAX_LEVELS levels or more is counted in the last bucket of the histogram
+  */
+class CountingHooks : public NoHooks
+{
+ public:
+	enum { MAX_LEVELS = 32 };
+
+ private:
+	long compares ;
+	long swaps ;
+
+	// indexed by SiftDirection
+	long sifts[2] ;
+	long nodes[2] ;
+	long levels[2][ MAX_LEVELS ] ;
+
+ public:
+	CountingHooks() { reset(); }
+
+	void compared() { ++compares ; }
+	void swapped() { ++swaps ; }
+	void sifted( SiftDirection d, int lv, int n )
+	{
+		++sifts[d] ;
+		nodes[d] += n ;
+		++levels[d][ lv < MAX_LEVELS ? lv : MAX_LEVELS - 1 ] ;
+	}
+
+	// the counts since construction, or since the last reset()
+	long comparisons() const { return compares ; }
+	long swapCount() const { return swaps ; }
+	long siftCount( SiftDirection d ) const { return sifts[d] ; }
+	long nodesTouched( SiftDirection d ) const { return nodes[d] ; }
+	long siftsOfDepth( SiftDirection d, int lv ) const { return levels[d][lv] ; }
+
+	void reset()
+	{
+		compares = swaps = 0 ;
+		for( int d = 0 ; d < 2 ; d++ )
+		{
+			sifts[d] = nodes[d] = 0 ;
+			for( int lv = 0 ; lv < MAX_LEVELS ; lv++ )
+				levels[d][lv] = 0 ;
+		}
+	}
+
+	// all the counts, then one line per sift depth that occurred
+	void print( std::ostream& os ) const
+	{
+		std::ios::fmtflags flags = os.flags();
+		std::streamsize precision = os.precision();
+		os << "comparisons: " << compares << "\nswaps: " << swaps << '\n' ;
+		const char* name[2] = { "siftUp", "siftDown" };
+		for( int d = 0 ; d < 2 ; d++ )
+		{
+			os << name[d] << ": " << sifts[d] << " calls, " << nodes[d] << " nodes touched" ;
+			if( sifts[d] )
+				os << ", " << std::fixed << std::setprecision( 2 ) << double( nodes[d] ) / sifts[d] << " per call" ;
+			os << '\n' ;
+			for( int lv = 0 ; lv < MAX_LEVELS ; lv++ )
+				if( levels[d][lv] )
+					os << "  " << std::setw( 2 ) << lv << ( lv == MAX_LEVELS - 1 ? "+" : " " ) << " levels: " << levels[d][lv] << '\n' ;
+		}
+		os.flags( flags );
+		os.precision( precision );
+	}
+};
+/* class CountingHooks */
+
+#endif // MHS_CODEBLOCKS_CPP_HEAP_HOOKS_HPP
@@ -12,11 +12,100 @@
 // NEED ALL THESE #include's FOR THE PROJECT TO COMPILE!!
 #include "Test.hpp"
 #include "Heap.cpp"
+#include "StaticHeap.cpp"
+#include "Slab.cpp"
+#include "HeapAdapter.cpp"
+#include "ConcurrentHeap.cpp"
+#include "MultiQueue.cpp"
 #include "ArrayHeap.cpp"
 #include "LinkHeap.cpp"
+#include "PairingHeap.cpp"
+#include "LeftistHeap.cpp"
+#include "KeyedHeap.cpp"
+#include "IntegerHeap.cpp"
+#include "RadixHeap.cpp"
+#include "BucketQueue.cpp"
+
+// instantiate the Heap interface with TestType
+template class Heap<TestType> ;
 
 // instantiate an ArrayHeap with TestType
+template class StaticHeap< ArrayHeap<TestType>, TestType > ;
 template class ArrayHeap<TestType> ;
 
+// and one that logs -- see Main.cpp
+template class StaticHeap< ArrayHeap< TestType, 2, RuntimePriority<TestType>, LogHooks >, TestType > ;
+template class ArrayHeap< TestType, 2, RuntimePriority<TestType>, LogHooks > ;
+
+// and a 4-ary one
+template class StaticHeap< ArrayHeap<TestType, 4>, TestType > ;
+template class ArrayHeap<TestType, 4> ;
+
+// and one of each kind that counts its operations -- see CountingHooks in Hooks.hpp
+template class StaticHeap< ArrayHeap< TestType, 4, RuntimePriority<TestType>, CountingHooks >, TestType > ;
+template class ArrayHeap< TestType, 4, RuntimePriority<TestType>, CountingHooks > ;
+template class StaticHeap< LinkHeap< TestType, RuntimePriority<TestType>, CountingHooks >, TestType > ;
+template class LinkHeap< TestType, RuntimePriority<TestType>, CountingHooks > ;
+template class PairingHeap< TestType, RuntimePriority<TestType>, CountingHooks > ;
+template class LeftistHeap< TestType, RuntimePriority<TestType>, CountingHooks > ;
+
 // instantiate a LinkHeap with TestType
+template class StaticHeap< LinkHeap<TestType>, TestType > ;
 template class LinkHeap<TestType> ;
+
+// instantiate a PairingHeap with TestType
+//   NOT its whole StaticHeap: the pop() of StaticHeap is replaced by its own, so it is never compiled for it
+template class PairingHeap<TestType> ;
+
+// and a LeftistHeap, the same way
+template class LeftistHeap<TestType> ;
+
+// and all of them behind the Heap<TestType> interface
+template class HeapAdapter< ArrayHeap<TestType> > ;
+template class HeapAdapter< LinkHeap<TestType> > ;
+template class HeapAdapter< PairingHeap<TestType> > ;
+template class HeapAdapter< LeftistHeap<TestType> > ;
+
+// an IntegerHeap holds integers only, so not TestType -- one of longs, and one of ints that gives the larger first
+//   with the KeyedHeap each of them is, and its StaticHeap
+template class StaticHeap< KeyedHeap< long, ElementKey<long>, 8, StaticPriority<long>, NoHooks, VectorSelect<long> >, long > ;
+template class KeyedHeap< long, ElementKey<long>, 8, StaticPriority<long>, NoHooks, VectorSelect<long> > ;
+template class IntegerHeap<long> ;
+template class StaticHeap< KeyedHeap< int, ElementKey<int>, 16, StaticPriority< int, std::less<int>, Heap<int>::LARGER_FIRST >,
+                                      NoHooks, VectorSelect< int, Heap<int>::LARGER_FIRST > >, int > ;
+template class KeyedHeap< int, ElementKey<int>, 16, StaticPriority< int, std::less<int>, Heap<int>::LARGER_FIRST >,
+                          NoHooks, VectorSelect< int, Heap<int>::LARGER_FIRST > > ;
+template class IntegerHeap< int, 16, Heap<int>::LARGER_FIRST > ;
+// and one of 6 unsigned longs a node, which fill three 16-byte vectors -- see VectorSelect in Select.hpp
+template class StaticHeap< KeyedHeap< unsigned long, ElementKey<unsigned long>, 6, StaticPriority<unsigned long>, NoHooks,
+                                      VectorSelect<unsigned long> >, unsigned long > ;
+template class KeyedHeap< unsigned long, ElementKey<unsigned long>, 6, StaticPriority<unsigned long>, NoHooks, VectorSelect<unsigned long> > ;
+template class IntegerHeap< unsigned long, 6 > ;
+// and one of longs in the paged layout -- see PagedLayout in Layout.hpp
+template class StaticHeap< KeyedHeap< long, ElementKey<long>, 8, StaticPriority<long>, NoHooks, VectorSelect<long>, PagedLayout<8> >, long > ;
+template class KeyedHeap< long, ElementKey<long>, 8, StaticPriority<long>, NoHooks, VectorSelect<long>, PagedLayout<8> > ;
+template class IntegerHeap< long, 8, Heap<long>::SMALLER_FIRST, NoHooks, PagedLayout<8> > ;
+template class HeapAdapter< IntegerHeap<long> > ;
+
+// a KeyedHeap of TestType, which sifts only the values -- see TestKey in Test.hpp
+template class StaticHeap< KeyedHeap<TestType, TestKey>, TestType > ;
+template class KeyedHeap<TestType, TestKey> ;
+template class HeapAdapter< KeyedHeap<TestType, TestKey> > ;
+
+// a RadixHeap of TestType by its value, one of ints that gives the larger first, and one of longs
+//   NOT its StaticHeap, like PairingHeap
+template class RadixHeap<TestType, TestKey> ;
+template class RadixHeap< int, ElementKey<int>, Heap<int>::LARGER_FIRST > ;
+template class RadixHeap<long> ;
+template class HeapAdapter< RadixHeap<TestType, TestKey> > ;
+
+// a BucketQueue of TestType by its value, and one of ints that gives the larger first -- NOT their StaticHeap either
+template class BucketQueue<TestType, TestKey> ;
+template class BucketQueue< int, ElementKey<int>, Heap<int>::LARGER_FIRST > ;
+template class HeapAdapter< BucketQueue<TestType, TestKey> > ;
+
+// and an ArrayHeap shared between threads
+template class ConcurrentHeap< ArrayHeap<TestType> > ;
+
+// and a relaxed queue of ArrayHeaps
+template class MultiQueue<TestType> ;
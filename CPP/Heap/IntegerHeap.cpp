@@ -0,0 +1,24 @@
+/*
+ * IntegerHeap.cpp
+ *   Created on: Oct 18, 2026
+ */
+
+#include "IntegerHeap.hpp"
+
+/*************************************
+        IntegerHeap MEMBER FUNCTIONS
+    *************************************/
+
+template<typename dataType, int arity, typename Heap<dataType>::order ordering, typename Hooks, typename Layout>
+IntegerHeap<dataType, arity, ordering, Hooks, Layout>::IntegerHeap( bool vectors )
+{
+  Base::useVectors( vectors );
+
+}// IntegerHeap CONSTRUCTOR
+
+template<typename dataType, int arity, typename Heap<dataType>::order ordering, typename Hooks, typename Layout>
+bool IntegerHeap<dataType, arity, ordering, Hooks, Layout>::available()
+{
+  return VectorSelect<dataType, ordering>::tier( arity ) != SCALAR_TIER ;
+
+}// available()
@@ -0,0 +1,80 @@
+/*
+ * IntegerHeap.hpp
+ *   Created on: Oct 18, 2026
+ */
+
+#ifndef MHS_CODEBLOCKS_CPP_HEAP_INTEGERHEAP_HPP
+#define MHS_CODEBLOCKS_CPP_HEAP_INTEGERHEAP_HPP
+
+using namespace std;
+
+#include <functional>
+#include <type_traits>
+#include "Heap.hpp"
+#include "Priority.hpp"
+#include "Hooks.hpp"
+#include "Select.hpp"
+#include "KeyedHeap.hpp"
+
+/***
+  ** class IntegerHeap - a wide array heap of integers, which picks the best child with vector instructions
+  **
+  **   a KeyedHeap whose elements are their own keys, with a VectorSelect -- use HeapAdapter< IntegerHeap<dataType> >
+  **   for a Heap<dataType>
+  **   'dataType' is an integer type, signed or not, and the order is fixed at compile time:
+  **   the same as an ArrayHeap< dataType, arity, StaticPriority< dataType, std::less<dataType>, ordering > >
+  **     - the keys are in an array of their own, in heap order, so the 'arity' children of a node are
+  **       'arity' integers next to each other -- see KeyedHeap.hpp
+  **     - siftDown() finds the best of them with AVX2 or SSE4 instructions when the CPU has them and the
+  **       children fill whole vectors, and with a plain loop otherwise -- see VectorSelect in Select.hpp
+  **     - equal keys are ordered by their ids, as in every other heap
+  **     - 'Layout' places the keys in the array, as in KeyedHeap: FlatLayout by default, or the opt-in
+  **       PagedLayout for one of many millions -- see Layout.hpp
+  **   each integer is still in its node as well, as the element of its handle, but top() and the sifts only
+  **   read the array
+  **
+  **    OPERATIONS:
+  **
+  **    -  IntegerHeap( bool vectors = true );
+  **         false always picks the children with the plain loop, e.g. to compare the two
+  **
+  **    -  bool vectorized() const ;
+  **         true if siftDown() uses the vector instructions
+  **
+  **    -  static bool available();
+  **         true if this CPU, and this kind of IntegerHeap, can use the vector instructions
+  **/
+template<typename dataType, int arity = 8, typename Heap<dataType>::order ordering = Heap<dataType>::SMALLER_FIRST,
+         typename Hooks = NoHooks, typename Layout = FlatLayout<arity> >
+class IntegerHeap: public KeyedHeap< dataType, ElementKey<dataType>, arity, StaticPriority< dataType, std::less<dataType>, ordering >,
+                                     Hooks, VectorSelect<dataType, ordering>, Layout >
+{
+  static_assert( std::is_integral<dataType>::value, "an IntegerHeap holds integers" );
+  static_assert( arity <= 32, "an IntegerHeap has at most 32 children per node" );
+
+ private:
+  typedef KeyedHeap< dataType, ElementKey<dataType>, arity, StaticPriority< dataType, std::less<dataType>, ordering >,
+                     Hooks, VectorSelect<dataType, ordering>, Layout > Base ;
+
+ public:
+
+  // usual constructor business -- see the class comment
+  explicit IntegerHeap( bool = true );
+
+  // build the heap from all the elements of an iterator range, in O(n)
+  template<typename Iterator>
+  IntegerHeap( Iterator begin, Iterator end, bool vectors = true )
+               : Base( begin, end )
+  {
+    Base::useVectors( vectors );
+  }
+
+  // see the class comment
+  static bool available();
+
+  // the element is its key: no need to read its node
+  const dataType& top() const { return Base::topKey(); }
+
+};// class IntegerHeap
+
+#endif // MHS_CODEBLOCKS_CPP_HEAP_INTEGERHEAP_HPP
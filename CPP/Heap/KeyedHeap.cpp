@@ -0,0 +1,322 @@
+/*
+ * KeyedHeap.cpp
+ *   Created on: Oct 18, 2026
+ */
+
+#include "KeyedHeap.hpp"
+
+/*************************************
+        KeyedHeap MEMBER FUNCTIONS
+    *************************************/
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::KeyedHeap( const Priority& p, const KeyOf& k )
+                  : priority( p ), keyOf( k ), tier( Select::tier(arity) )
+{
+  hooks.created( "KeyedHeap", 0 );
+}// KeyedHeap CONSTRUCTOR
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::KeyedHeap( const KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>& hp )
+                  : Base( hp ), priority( hp.priority ), keyOf( hp.keyOf ), hooks( hp.hooks ), tier( hp.tier )
+{
+  copy( hp );
+  hooks.created( "KeyedHeap", Base::size() );
+
+}// KeyedHeap COPY CONSTRUCTOR
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::~KeyedHeap()
+{
+  hooks.destroyed( "KeyedHeap", Base::size() );
+  destroy();
+
+}// KeyedHeap DESTRUCTOR
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>& KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::operator=( const KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>& hp )
+{
+  if( this == &hp )
+    return *this ;
+
+  destroy();
+  Base::operator=( hp );
+  priority = hp.priority ;
+  keyOf = hp.keyOf ;
+  hooks = hp.hooks ;
+  tier = hp.tier ;
+
+  copy( hp );
+  return *this ;
+
+}// KeyedHeap ASSIGNMENT OVERLOAD
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+void KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::copy( const KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>& hp )
+{
+  // same elements, keys and ids, same positions
+  for( int pos = 0 ; pos < hp.size() ; pos++ )
+  {
+    unsigned int i = slab.allocate();
+    KeyedNode* n = new( slab[i] ) KeyedNode( *hp.slab[ hp.nodeAt(pos) ] );
+    n->self = i ;
+    if( i >= where.size() )
+      where.resize( 2 * i + 2 );
+    Slot s = { hp.slots[ Layout::store(pos) ].id, i };
+    add( pos, hp.keys[ Layout::store(pos) ], s );
+  }
+}// copy()
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+void KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::destroy()
+{
+  for( int pos = 0 ; pos < Base::size() ; pos++ )
+    slab.release( nodeAt(pos) );
+  keys.clear();
+  slots.clear();
+  Base::number_of_elements = 0 ;
+
+}// destroy()
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+void KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::exchange( int a, int b )
+{
+  hooks.swapped();
+  int i = Layout::store( a ), j = Layout::store( b );
+  key k = keys[i] ;
+  Slot s = slots[i] ;
+  place( a, keys[j], slots[j] );
+  place( b, k, s );
+
+}// exchange()
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+void KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::siftUp( typename Heap<dataType>::Handle& h )
+{
+  // the key is kept aside while its ancestors come down into the hole, and only put in at the end
+  int pos = where[ static_cast<KeyedNode&>(h).self ] ;
+  key k = keys[ Layout::store(pos) ] ;
+  Slot s = slots[ Layout::store(pos) ] ;
+  int levels = 0, touched = 1 ;
+
+  while( pos > 0 )
+  {
+    int dad = Layout::parent( pos ), d = Layout::store( dad );
+    ++touched ;
+    hooks.compared();
+    if( !priority(k, s.id, keys[d], slots[d].id) )
+      break ;
+    hooks.swapped();
+    place( pos, keys[d], slots[d] );
+    pos = dad ;
+    ++levels ;
+  }
+  place( pos, k, s );
+  hooks.sifted( SIFT_UP, levels, touched );
+
+}// siftUp()
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+void KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::siftDown( typename Heap<dataType>::Handle& h )
+{
+  siftDownAt( where[ static_cast<KeyedNode&>(h).self ] );
+
+}// siftDown()
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+void KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::siftDownAt( int pos )
+{
+#ifdef MHS_HEAP_VECTORS
+  if( tier == AVX2_TIER )
+  {
+    sinkAvx2( pos );
+    return ;
+  }
+  if( tier == SSE4_TIER )
+  {
+    sinkSse4( pos );
+    return ;
+  }
+#endif
+  sink< typename Select::template Lanes<SCALAR_TIER> >( pos );
+
+}// siftDownAt()
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+template<typename Lanes>
+void KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::sink( int pos )
+{
+  // the best child comes up into the hole, as in siftUp()
+  int size = Base::size();
+  key k = keys[ Layout::store(pos) ] ;
+  Slot s = slots[ Layout::store(pos) ] ;
+  int levels = 0, touched = 1 ;
+
+  while( true )
+  {
+    int first = Layout::child( pos );
+    if( first >= size )
+      break ;
+
+    // the children are next to each other in the arrays, from f on: c is the best of them
+    int count = first + arity <= size ? arity : size - first ;
+    int f = Layout::store( first ), c = f ;
+    touched += count ;
+    if( Lanes::VECTOR && count == arity )
+    {
+      for( int i = 1 ; i < arity ; i++ )
+        hooks.compared();
+
+      // all the children at once, from a group aligned to its size -- then equal keys: the ids decide
+      unsigned int mask = Lanes::best( &keys[f], arity );
+      c = f + __builtin_ctz( mask );
+      for( mask &= mask - 1 ; mask ; mask &= mask - 1 )
+      {
+        int i = f + __builtin_ctz( mask );
+        if( priority(keys[i], slots[i].id, keys[c], slots[c].id) )
+          c = i ;
+      }
+    }
+    else
+      for( int i = f + 1 ; i < f + count ; i++ )
+      {
+        hooks.compared();
+        if( priority(keys[i], slots[i].id, keys[c], slots[c].id) )
+          c = i ;
+      }
+
+    hooks.compared();
+    if( !priority(keys[c], slots[c].id, k, s.id) )
+      break ;
+    hooks.swapped();
+    place( pos, keys[c], slots[c] );
+    pos = first + ( c - f );
+    ++levels ;
+  }
+  place( pos, k, s );
+  hooks.sifted( SIFT_DOWN, levels, touched );
+
+}// sink()
+
+#ifdef MHS_HEAP_VECTORS
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+MHS_SSE4 void KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::sinkSse4( int pos )
+{
+  // sink() is compiled again in here, for SSE4
+  sink< typename Select::template Lanes<SSE4_TIER> >( pos );
+
+}// sinkSse4()
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+MHS_AVX2 void KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::sinkAvx2( int pos )
+{
+  // sink() is compiled again in here, for AVX2
+  sink< typename Select::template Lanes<AVX2_TIER> >( pos );
+
+}// sinkAvx2()
+#endif
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+typename Heap<dataType>::Handle& KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::first()
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+  return *slab[ nodeAt(0) ];
+
+}// first()
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+void KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::moveLastToFirst()
+{
+  exchange( 0, Base::size() - 1 );
+
+}// moveLastToFirst()
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+void KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::deleteLast()
+{
+  // the arrays keep their places: the next push uses them again
+  slab.release( nodeAt( Base::size() - 1 ) );
+
+}// deleteLast()
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+typename Heap<dataType>::Handle& KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::moveLastTo( typename Heap<dataType>::Handle& h )
+{
+  int pos = where[ static_cast<KeyedNode&>(h).self ] ;
+  exchange( pos, Base::size() - 1 );
+  return *slab[ nodeAt(pos) ];
+
+}// moveLastTo()
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+void KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::heapify()
+{
+  // Floyd's bottom-up construction, as in ArrayHeap
+  if( Base::size() < 2 )
+    return ;
+
+  for( int pos = Layout::lastParent( Base::size() ) ; pos >= 0 ; pos-- )
+    siftDownAt( pos );
+
+}// heapify()
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+template<typename Take>
+void KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::takeAll( Take take )
+{
+  for( int pos = 0 ; pos < Base::size() ; pos++ )
+    take( *slab[ nodeAt(pos) ] );
+  destroy();
+
+}// takeAll()
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+void KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::priorityChange( typename Heap<dataType>::Handle& h )
+{
+  keys[ Layout::store( where[ static_cast<KeyedNode&>(h).self ] ) ] = keyOf( *h );
+  Base::priorityChange( h );
+
+}// priorityChange()
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+const dataType& KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::top() const
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+  return **slab[ nodeAt(0) ];
+
+}// top()
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+const typename KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::key& KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::topKey() const
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+  return keys[ Layout::store(0) ] ;
+
+}// topKey()
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+void KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::print( ostream& os, int pos, int k ) const
+{
+  for( int i = 0; i < k; ++i )
+  {
+    os << "  " ;
+  }
+  const Slot& s = slots[ Layout::store(pos) ] ;
+  os << **slab[ s.node ] << "  ( pos=" << pos << ", id=" << s.id << ", node=" << s.node << " )" << endl;
+
+  for( int c = Layout::child( pos ) ; c < Layout::child( pos ) + arity && c < Base::size() ; c++ )
+    print( os, c, k + 1 );
+
+}// print()
+
+template<typename dataType, typename KeyOf, int arity, typename Priority, typename Hooks, typename Select, typename Layout>
+void KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>::print( ostream& os ) const
+{
+  os << "size = " << Base::size() << ( vectorized() ? ", vectors" : "" ) << endl;
+  if( !Base::vide() )
+    print( os, 0 );
+
+}// print()
@@ -0,0 +1,287 @@
+/*
+ * KeyedHeap.hpp
+ *   Created on: Oct 18, 2026
+ */
+
+#ifndef MHS_CODEBLOCKS_CPP_HEAP_KEYEDHEAP_HPP
+#define MHS_CODEBLOCKS_CPP_HEAP_KEYEDHEAP_HPP
+
+using namespace std;
+
+#include <iostream>
+#include <vector>
+#include <new>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+#include "Heap.hpp"
+#include "StaticHeap.hpp"
+#include "Priority.hpp"
+#include "Hooks.hpp"
+#include "Select.hpp"
+#include "Layout.hpp"
+#include "Slab.hpp"
+
+// the type of the key that a KeyOf functor takes out of an element
+template<typename dataType, typename KeyOf>
+struct KeyType
+{
+  typedef typename std::decay< decltype( std::declval<const KeyOf&>()( std::declval<const dataType&>() ) ) >::type type ;
+};
+
+// the KeyOf of an element that is its own key, e.g. an integer
+template<typename dataType>
+struct ElementKey
+{
+  const dataType& operator()( const dataType& e ) const { return e ; }
+};
+
+// the allocator of an array that starts at a multiple of 'bytes', e.g. a cache line
+template<typename T, int bytes>
+struct AlignedAllocator
+{
+  typedef T value_type ;
+  template<typename U> struct rebind { typedef AlignedAllocator<U, bytes> other ; };
+
+  AlignedAllocator() {}
+  template<typename U> AlignedAllocator( const AlignedAllocator<U, bytes>& ) {}
+
+  // a few bytes more than asked for, and the start of them kept just before the array
+  T* allocate( std::size_t n )
+  {
+    char* raw = static_cast<char*>( ::operator new( n * sizeof(T) + bytes + sizeof(void*) ) );
+    std::uintptr_t p = ( reinterpret_cast<std::uintptr_t>( raw + sizeof(void*) ) + bytes - 1 ) & ~std::uintptr_t( bytes - 1 );
+    reinterpret_cast<void**>( p )[-1] = raw ;
+    return reinterpret_cast<T*>( p );
+  }
+  void deallocate( T* p, std::size_t ) { ::operator delete( reinterpret_cast<void**>( p )[-1] ); }
+
+  template<typename U> bool operator==( const AlignedAllocator<U, bytes>& ) const { return true ; }
+  template<typename U> bool operator!=( const AlignedAllocator<U, bytes>& ) const { return false ; }
+};
+
+/***
+  ** class KeyedHeap - an array heap of big elements, which sifts only their keys
+  **
+  **   Subclass of StaticHeap -- use HeapAdapter< KeyedHeap<dataType, KeyOf> > for a Heap<dataType>
+  **   'KeyOf' is a functor that returns the key of an element, e.g. the priority field of a record:
+  **     struct JobKey { long operator()( const Job& j ) const { return j.priority ; } };
+  **   'Priority' decides which of two KEYS comes first -- see Priority.hpp
+  **   'Select' picks the best of the children of a node -- see Select.hpp: the default ScalarSelect compares
+  **   them one by one, a VectorSelect compares integer keys with vector instructions
+  **   a structure of arrays: the keys are copied into an array of their own, in heap order, next to an array
+  **   of the ids and slab indices of their elements -- and the elements themselves stay in a Slab and never move
+  **     - siftUp() and siftDown() compare and move only keys and small indices: a node of 'arity' children
+  **       is one stretch of keys, and a sift never reads an element
+  **     - an element is read when it is pushed, when its key changes, at top() and when it is popped
+  **   'Layout' says where each position is in the arrays -- see Layout.hpp: the children of a node are always
+  **   a group of 'arity' places that starts at a multiple of 'arity', in arrays that start on a cache line,
+  **   so a group of 16, 32 or 64 bytes of keys never crosses one -- and a key must have a default constructor,
+  **   for the places that no position uses
+  **   the same order as an ArrayHeap whose Priority compares the keys of the elements, equal keys by their ids
+  **
+  **    OPERATIONS:
+  **
+  **    -  KeyedHeap( const Priority& = Priority(), const KeyOf& = KeyOf() );
+  **
+  **    -  const key& topKey() const ;
+  **         the key of the top element, without reading the element
+  **
+  **    -  bool vectorized() const ;
+  **         true if siftDown() picks the children with vector instructions -- see Select.hpp
+  **
+  **    -  SelectTier selectTier() const ;
+  **         which ones: SSE4_TIER or AVX2_TIER, or SCALAR_TIER for none
+  **/
+template<typename dataType, typename KeyOf, int arity = 4,
+         typename Priority = StaticPriority< typename KeyType<dataType, KeyOf>::type >, typename Hooks = NoHooks,
+         typename Select = ScalarSelect, typename Layout = FlatLayout<arity> >
+class KeyedHeap: public StaticHeap< KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>, dataType >
+{
+  static_assert( arity >= 2, "a KeyedHeap has at least 2 children per node" );
+  static_assert( Layout::ARITY == arity, "the Layout of a KeyedHeap must have the same arity" );
+
+ public:
+  typedef typename KeyType<dataType, KeyOf>::type key ;
+
+ private:
+  typedef StaticHeap< KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>, dataType > Base ;
+  friend class StaticHeap< KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>, dataType > ;
+
+  /***
+    ** KeyedNode subclass of Heap<dataType>::Handle
+    **/
+  class KeyedNode: public Heap<dataType>::Handle
+  {
+   public:
+    // the slab index of the node itself
+    unsigned int self;
+
+    // CONSTRUCTOR: the element is built in place from the arguments
+    template<typename... Args>
+    KeyedNode( unsigned int i, long id, Args&&... args )
+               : Heap<dataType>::Handle( typename Heap<dataType>::InPlace(), id, std::forward<Args>(args)... ),
+                 self( i ) {}
+
+  };
+  /* inner class KeyedHeap::KeyedNode */
+
+  // which of two keys comes first
+  Priority priority ;
+
+  // the key of an element
+  KeyOf keyOf ;
+
+  // told about the events of the heap -- see Hooks.hpp
+  Hooks hooks ;
+
+  // the storage of the elements
+  Slab<KeyedNode> slab ;
+
+  // the id and the slab index of the element at a position
+  struct Slot
+  {
+    long id ;
+    unsigned int node ;
+  };
+
+  // the heap order: keys[ Layout::store(pos) ] is the key of the element at position pos, and slots[] its node
+  std::vector< key, AlignedAllocator<key, Layout::ALIGN> > keys ;
+  std::vector< Slot, AlignedAllocator<Slot, Layout::ALIGN> > slots ;
+
+  // the position of each node, by slab index
+  std::vector<int> where ;
+
+  // the widest instructions siftDown() picks the children with
+  SelectTier tier ;
+
+  // put a key and its slot at a position
+  void place( int pos, const key& k, const Slot& s )
+  {
+    keys[ Layout::store(pos) ] = k ;
+    slots[ Layout::store(pos) ] = s ;
+    where[s.node] = pos ;
+  }
+
+  // make room in the arrays for a new position, and put a key and its slot there
+  void add( int pos, const key& k, const Slot& s )
+  {
+    unsigned int i = Layout::store( pos );
+    if( i >= keys.size() )
+    {
+      keys.resize( i + 1 );
+      slots.resize( i + 1 );
+    }
+    place( pos, k, s );
+  }
+
+  // the node at a position
+  unsigned int nodeAt( int pos ) const { return slots[ Layout::store(pos) ].node ; }
+
+  // exchange the elements at two positions
+  void exchange( int, int );
+
+  // sift the key at a position down -- with the widest instructions of 'tier'
+  void siftDownAt( int );
+
+  // the same, with a Lanes of the Select for the children that are all there -- see Select.hpp
+  template<typename Lanes>
+  void sink( int );
+#ifdef MHS_HEAP_VECTORS
+  MHS_SSE4 void sinkSse4( int );
+  MHS_AVX2 void sinkAvx2( int );
+#endif
+
+  // construct a new node in the slab, with the next id, and put its key at the end
+  template<typename... Args>
+  KeyedNode* make( Args&&... args )
+  {
+    unsigned int i = slab.allocate();
+    KeyedNode* n = new( slab[i] ) KeyedNode( i, ++Base::last_id, std::forward<Args>(args)... );
+    if( i >= where.size() )
+      where.resize( 2 * i + 2 );
+    Slot s = { Base::id( *n ), i };
+    add( Base::size(), keyOf( **n ), s );
+    return n ;
+  }
+
+  // duplicate the elements of another heap, position by position
+  void copy( const KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>& );
+
+  // release every node
+  void destroy();
+
+  // print a position and everything below it
+  void print( ostream&, int, int = 0 ) const ;
+
+ protected:
+
+  // pick the children one by one from now on, if not 'vectors'
+  void useVectors( bool vectors ) { tier = vectors ? Select::tier( arity ) : SCALAR_TIER ; }
+
+  // see StaticHeap.hpp
+  // the primitive operations used by StaticHeap
+  //
+  void siftUp( typename Heap<dataType>::Handle& );
+  void siftDown( typename Heap<dataType>::Handle& );
+  template<typename... Args>
+  typename Heap<dataType>::Handle& createNew( Args&&... args )
+  {
+    return *make( std::forward<Args>(args)... );
+  }
+  typename Heap<dataType>::Handle& first();
+  void moveLastToFirst();
+  void deleteLast();
+  typename Heap<dataType>::Handle& moveLastTo( typename Heap<dataType>::Handle& );
+  template<typename... Args>
+  typename Heap<dataType>::Handle& append( Args&&... args )
+  {
+    typename Heap<dataType>::Handle& h = createNew( std::forward<Args>(args)... );
+    ++Base::number_of_elements ;
+    return h ;
+  }
+  void heapify();
+  template<typename Take>
+  void takeAll( Take );
+
+ public:
+
+  // usual constructor and destructor business
+  explicit KeyedHeap( const Priority& = Priority(), const KeyOf& = KeyOf() );
+
+  // build the heap from all the elements of an iterator range, in O(n)
+  template<typename Iterator>
+  KeyedHeap( Iterator begin, Iterator end, const Priority& p = Priority(), const KeyOf& k = KeyOf() )
+             : priority( p ), keyOf( k ), tier( Select::tier(arity) )
+  {
+    for( ; begin != end ; ++begin )
+      append( *begin );
+    heapify();
+    hooks.created( "KeyedHeap", Base::size() );
+  }
+
+  KeyedHeap( const KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>& );
+  KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>& operator=( const KeyedHeap<dataType, KeyOf, arity, Priority, Hooks, Select, Layout>& );
+  ~KeyedHeap();
+
+  // the Hooks object, e.g. to read what it has recorded
+  Hooks& instrumentation() { return hooks ; }
+
+  // used for debugging
+  void print( ostream& ) const ;
+
+  const dataType& top() const ;
+
+  // see the class comment
+  const key& topKey() const ;
+  bool vectorized() const { return tier != SCALAR_TIER ; }
+  SelectTier selectTier() const { return tier ; }
+
+  // the key of the element has to be taken out again before it is sifted
+  void priorityChange( typename Heap<dataType>::Handle& );
+  void priorityChange( typename Heap<dataType>::Handle& h, const dataType& e )
+  { Base::priorityChange( h, e ); }
+
+};// class KeyedHeap
+
+#endif // MHS_CODEBLOCKS_CPP_HEAP_KEYEDHEAP_HPP
@@ -0,0 +1,135 @@
+/*
+ * Layout.hpp
+ *   Created on: Oct 18, 2026
+ */
+
+#ifndef MHS_CODEBLOCKS_CPP_HEAP_LAYOUT_HPP
+#define MHS_CODEBLOCKS_CPP_HEAP_LAYOUT_HPP
+
+#include <climits>
+
+/***
+  **  LAYOUT classes
+  **
+  **    a KeyedHeap asks its Layout where the parent and the children of a position are, and where a position
+  **    is stored in its arrays of keys and slots -- the positions 0 .. size()-1 are always the elements,
+  **    0 is the top, and the 'arity' children of a position are always next to each other
+  **
+  **    OPERATIONS:
+  **
+  **    -  enum { ARITY, ALIGN };
+  **         the number of children of a position -- the same as the arity of the KeyedHeap -- and the
+  **         multiple of bytes the arrays start at
+  **
+  **    -  static int child( int a );
+  **         the position of the first child of a -- any value >= size() if a has no children
+  **
+  **    -  static int parent( int a );
+  **         the position of the parent of a, for a > 0
+  **
+  **    -  static int lastParent( int n );
+  **         a position at or after the last one that has a child, in a heap of n > 1 elements
+  **         -- heapify() sifts down every position from there to 0
+  **
+  **    -  static int store( int a );
+  **         the index of position a in the arrays -- the children of a position are there from a multiple
+  **         of 'arity' on, so a group of them never crosses an ALIGN boundary
+  **
+  ***/
+
+/**
+  *  FlatLayout class
+  *    - the default, the usual implicit tree: the children of a are at a*arity + 1 ...
+  *    - a level is one stretch of the arrays, so below the first few levels each level of a sift
+  *      touches a new cache line -- and a new page, once the arrays are bigger than a few MB
+  */
+template<int arity>
+class FlatLayout
+{
+ public:
+	enum { ARITY = arity, ALIGN = 64 };
+
+	static int child( int a ) { return a*arity + 1 ; }
+	static int parent( int a ) { return (a-1) / arity ; }
+	static int lastParent( int n ) { return parent( n - 1 ); }
+
+	// the top 'arity - 1' places in, so that its children start at 'arity', theirs at arity*arity ...
+	static int store( int a ) { return a + arity - 1 ; }
+};
+/* class FlatLayout */
+
+// the bottom row of a subtree of PagedLayout: rows of arity, arity^2, ... positions, as many as fit in 'room'
+constexpr int pagedBottomRow( int room, int arity, int row )
+{ return room - row >= row * arity ? pagedBottomRow( room - row, arity, row * arity ) : row ; }
+
+/**
+  *  PagedLayout class
+  *    - a B-heap: the arrays are cut into pages of 'pageBytes', of keys of 'entryBytes', and each page holds
+  *      whole subtrees a few levels deep -- the 'arity' children of one position above, and their descendants
+  *      down to a bottom row, whose children are the roots of the subtrees below
+  *    - so a sift from the top to a leaf touches O(log n / log pageSize) pages of keys instead of O(log n)
+  *    - the top is alone in a page before the others, and as many subtrees as fit go in each page after it
+  *    - the subtrees are filled one after the other, in order, so the positions stay 0 .. size()-1:
+  *      a subtree of the next level is started before the one above is full, and the tree is up to one
+  *      subtree deeper than a flat one
+  *    - e.g. IntegerHeap< long, 8, Heap<long>::SMALLER_FIRST, NoHooks, PagedLayout<8> >
+  *    - OPT-IN, and measured slower than FlatLayout at 10M elements with 4 KB pages: every sift also writes
+  *      the table of positions, which is not paged, store() divides by a subtree size that is not a power
+  *      of 2, and the slots are twice as big as the keys, so each page of keys has two pages of slots
+  *      -- HeapBench layout runs the comparison
+  */
+template<int arity, int pageBytes = 4096, int entryBytes = sizeof(void*)>
+class PagedLayout
+{
+ public:
+	enum { ARITY = arity, ALIGN = pageBytes };
+
+	// the positions of a subtree, and those of its bottom row -- each with one subtree below it
+	enum { ROOM = pageBytes / entryBytes };
+	enum { BOTTOM = pagedBottomRow( ROOM, arity, arity ) };
+	enum { SLOTS = arity * ( BOTTOM - 1 ) / ( arity - 1 ) };
+
+	// the subtrees in a page
+	enum { TREES = ROOM / SLOTS };
+
+	static int child( int a )
+	{
+		if( a == 0 )
+		  return 1 ;
+
+		int tree = (a-1) / SLOTS, i = (a-1) % SLOTS ;
+		if( i < SLOTS - BOTTOM )
+		  return 1 + tree*SLOTS + arity*(i+1) ;
+
+		// the first position of the subtree below -- far down the arrays, past the end of any array of ints
+		// if the heap is big, which is the same as no children
+		long long below = 1 + ( (long long)tree * BOTTOM + 1 + i - (SLOTS - BOTTOM) ) * SLOTS ;
+		return below < INT_MAX - arity ? int( below ) : INT_MAX - arity ;
+	}
+
+	static int parent( int a )
+	{
+		int tree = (a-1) / SLOTS, i = (a-1) % SLOTS ;
+		if( i >= arity )
+		  return 1 + tree*SLOTS + i/arity - 1 ;
+		if( tree == 0 )
+		  return 0 ;
+
+		// a root of the subtree: its parent is in the bottom row of the subtree above
+		return 1 + ( (tree-1) / BOTTOM ) * SLOTS + SLOTS - BOTTOM + (tree-1) % BOTTOM ;
+	}
+
+	// any full subtree before the last one has children within itself -- siftDown() of a leaf returns at once
+	static int lastParent( int n ) { return n - 1 ; }
+
+	static int store( int a )
+	{
+		if( a == 0 )
+		  return ROOM - 1 ;
+		int tree = (a-1) / SLOTS ;
+		return ROOM * ( 1 + tree / TREES ) + ( tree % TREES ) * SLOTS + (a-1) % SLOTS ;
+	}
+};
+/* class PagedLayout */
+
+#endif // MHS_CODEBLOCKS_CPP_HEAP_LAYOUT_HPP
@@ -0,0 +1,384 @@
+/*
+ * LeftistHeap.cpp
+ *   Created on: Oct 18, 2026
+ */
+
+#include "LeftistHeap.hpp"
+
+/*************************************
+        LeftistHeap MEMBER FUNCTIONS
+    *************************************/
+
+template<typename dataType, typename Priority, typename Hooks>
+LeftistHeap<dataType, Priority, Hooks>::LeftistHeap( typename Heap<dataType>::compareFxn f, typename Heap<dataType>::order o )
+                    : priority( f, o ), pRoot( 0 )
+{
+  hooks.created( "LeftistHeap", 0 );
+}// LeftistHeap CONSTRUCTOR
+
+template<typename dataType, typename Priority, typename Hooks>
+LeftistHeap<dataType, Priority, Hooks>::LeftistHeap( const Priority& p )
+                    : priority( p ), pRoot( 0 )
+{
+  hooks.created( "LeftistHeap", 0 );
+}// LeftistHeap CONSTRUCTOR
+
+template<typename dataType, typename Priority, typename Hooks>
+LeftistHeap<dataType, Priority, Hooks>::LeftistHeap( const LeftistHeap<dataType, Priority, Hooks>& hp )
+                    : Base( hp ), priority( hp.priority ), hooks( hp.hooks ), pRoot( 0 )
+{
+  hooks.created( "LeftistHeap", Base::size() );
+  pRoot = copy( hp.pRoot );
+
+}// LeftistHeap COPY CONSTRUCTOR
+
+template<typename dataType, typename Priority, typename Hooks>
+LeftistHeap<dataType, Priority, Hooks>::~LeftistHeap()
+{
+  hooks.destroyed( "LeftistHeap", Base::size() );
+  destroy();
+
+}// LeftistHeap DESTRUCTOR
+
+template<typename dataType, typename Priority, typename Hooks>
+LeftistHeap<dataType, Priority, Hooks>& LeftistHeap<dataType, Priority, Hooks>::operator=( const LeftistHeap<dataType, Priority, Hooks>& hp )
+{
+  if( this == &hp )
+    return *this ;
+
+  destroy();
+  Base::operator=( hp );
+  priority = hp.priority ;
+  hooks = hp.hooks ;
+
+  pRoot = copy( hp.pRoot );
+  return *this ;
+
+}// LeftistHeap ASSIGNMENT OVERLOAD
+
+template<typename dataType, typename Priority, typename Hooks>
+typename LeftistHeap<dataType, Priority, Hooks>::LeftNode* LeftistHeap<dataType, Priority, Hooks>::meld( LeftistHeap<dataType, Priority, Hooks>::LeftNode* a,
+                                                                                          LeftistHeap<dataType, Priority, Hooks>::LeftNode* b )
+{
+  if( a == 0 )
+    return b ;
+  if( b == 0 )
+    return a ;
+
+  hooks.compared();
+  if( b->higherPriority( *a, priority ) )
+  {
+    LeftNode* tmp = a ;
+    a = b ;
+    b = tmp ;
+  }
+
+  // the lower root goes down the right spine of the higher one -- then the shorter spine is put back on the right
+  a->right = meld( a->right, b );
+  a->right->up = a ;
+  if( rank(a->left) < rank(a->right) )
+  {
+    LeftNode* tmp = a->left ;
+    a->left = a->right ;
+    a->right = tmp ;
+  }
+  a->rank = rank( a->right ) + 1 ;
+  return a ;
+
+}// meld()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LeftistHeap<dataType, Priority, Hooks>::cut( LeftistHeap<dataType, Priority, Hooks>::LeftNode* n )
+{
+  LeftNode* dad = n->up ;
+  if( dad == 0 )
+    return ;
+
+  if( dad->left == n )
+    dad->left = 0 ;
+  else
+      dad->right = 0 ;
+  n->up = 0 ;
+  fix( dad );
+
+}// cut()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LeftistHeap<dataType, Priority, Hooks>::fix( LeftistHeap<dataType, Priority, Hooks>::LeftNode* n )
+{
+  // a rank that does not change does not change the ranks above it either
+  for( ; n ; n = n->up )
+  {
+    if( rank(n->left) < rank(n->right) )
+    {
+      LeftNode* tmp = n->left ;
+      n->left = n->right ;
+      n->right = tmp ;
+    }
+    if( n->rank == rank(n->right) + 1 )
+      return ;
+    n->rank = rank( n->right ) + 1 ;
+  }
+}// fix()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LeftistHeap<dataType, Priority, Hooks>::detach( LeftistHeap<dataType, Priority, Hooks>::LeftNode* n )
+{
+  // the parent of n came before both of its children already
+  LeftNode* rest = meld( n->left, n->right );
+  LeftNode* dad = n->up ;
+  if( rest )
+    rest->up = dad ;
+  if( dad == 0 )
+    pRoot = rest ;
+  else
+  {
+    if( dad->left == n )
+      dad->left = rest ;
+    else
+        dad->right = rest ;
+    fix( dad );
+  }
+
+  n->left = n->right = n->up = 0 ;
+  n->rank = 1 ;
+
+}// detach()
+
+template<typename dataType, typename Priority, typename Hooks>
+typename LeftistHeap<dataType, Priority, Hooks>::LeftNode* LeftistHeap<dataType, Priority, Hooks>::copy( const LeftistHeap<dataType, Priority, Hooks>::LeftNode* n )
+{
+  if( n == 0 )
+    return 0 ;
+
+  // same elements and ids, same shape -- with a list of the nodes still to do instead of recursion,
+  // as the left paths of a leftist tree can be very long
+  std::vector< std::pair<const LeftNode*, LeftNode*> > todo ;
+  LeftNode* root = new LeftNode( *n );
+  root->up = 0 ;
+  todo.push_back( std::make_pair(n, root) );
+  while( !todo.empty() )
+  {
+    const LeftNode* from = todo.back().first ;
+    LeftNode* c = todo.back().second ;
+    todo.pop_back();
+
+    if( from->left )
+    {
+      c->left = new LeftNode( *from->left );
+      c->left->up = c ;
+      todo.push_back( std::make_pair(from->left, c->left) );
+    }
+    if( from->right )
+    {
+      c->right = new LeftNode( *from->right );
+      c->right->up = c ;
+      todo.push_back( std::make_pair(from->right, c->right) );
+    }
+  }
+  return root ;
+
+}// copy()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LeftistHeap<dataType, Priority, Hooks>::destroy()
+{
+  std::vector<LeftNode*> todo ;
+  if( pRoot )
+    todo.push_back( pRoot );
+  while( !todo.empty() )
+  {
+    LeftNode* n = todo.back();
+    todo.pop_back();
+    if( n->left ) todo.push_back( n->left );
+    if( n->right ) todo.push_back( n->right );
+    delete n ;
+  }
+  pRoot = 0 ;
+  Base::number_of_elements = 0 ;
+
+}// destroy()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LeftistHeap<dataType, Priority, Hooks>::siftUp( typename Heap<dataType>::Handle& h )
+{
+  LeftNode* n = &static_cast<LeftNode&>( h );
+  if( n == pRoot )
+    return ;
+  if( n->up )
+  {
+    hooks.compared();
+    if( !n->higherPriority(*n->up, priority) )
+      return ;
+  }
+
+  // the subtree is still in order below n -- only its link to the parent is not
+  cut( n );
+  pRoot = meld( pRoot, n );
+  pRoot->up = 0 ;
+
+}// siftUp()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LeftistHeap<dataType, Priority, Hooks>::siftDown( typename Heap<dataType>::Handle& h )
+{
+  LeftNode* n = &static_cast<LeftNode&>( h );
+  bool out = false ;
+  if( n->left )
+  {
+    hooks.compared();
+    out = n->left->higherPriority( *n, priority );
+  }
+  if( !out && n->right )
+  {
+    hooks.compared();
+    out = n->right->higherPriority( *n, priority );
+  }
+  if( !out )
+    return ;
+
+  // the children take the place of n, and n goes back in on its own
+  detach( n );
+  pRoot = meld( pRoot, n );
+  pRoot->up = 0 ;
+
+}// siftDown()
+
+template<typename dataType, typename Priority, typename Hooks>
+typename Heap<dataType>::Handle& LeftistHeap<dataType, Priority, Hooks>::first()
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+  return *pRoot ;
+
+}// first()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LeftistHeap<dataType, Priority, Hooks>::heapify()
+{
+  // meld the trees two by two, as a queue, so that most melds are of small trees: O(n) in all
+  if( pRoot )
+    pending.push_back( pRoot );
+  for( unsigned int i = 0 ; i + 1 < pending.size() ; i += 2 )
+    pending.push_back( meld(pending[i], pending[i + 1]) );
+
+  if( !pending.empty() )
+  {
+    pRoot = pending.back();
+    pRoot->up = 0 ;
+  }
+  pending.clear();
+
+}// heapify()
+
+template<typename dataType, typename Priority, typename Hooks>
+template<typename Take>
+void LeftistHeap<dataType, Priority, Hooks>::takeAll( Take take )
+{
+  std::vector<LeftNode*> todo ;
+  if( pRoot )
+    todo.push_back( pRoot );
+  while( !todo.empty() )
+  {
+    LeftNode* n = todo.back();
+    todo.pop_back();
+    if( n->left ) todo.push_back( n->left );
+    if( n->right ) todo.push_back( n->right );
+    take( *n );
+  }
+  destroy();
+
+}// takeAll()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LeftistHeap<dataType, Priority, Hooks>::pop()
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+
+  LeftNode* old = pRoot ;
+  pRoot = meld( old->left, old->right );
+  if( pRoot )
+    pRoot->up = 0 ;
+  delete old ;
+  --Base::number_of_elements ;
+
+}// pop()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LeftistHeap<dataType, Priority, Hooks>::erase( typename Heap<dataType>::Handle& h )
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+
+  LeftNode* n = &static_cast<LeftNode&>( h );
+  detach( n );
+  delete n ;
+  --Base::number_of_elements ;
+
+}// erase()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LeftistHeap<dataType, Priority, Hooks>::merge( LeftistHeap<dataType, Priority, Hooks>& hp )
+{
+  if( this == &hp )
+    return ;
+
+  // a tree in another order cannot be melded into ours
+  if( !( priority == hp.priority ) )
+  {
+    Base::merge( hp );
+    return ;
+  }
+
+  // the ids of the two heaps overlap, so equal elements from different heaps come out in no particular order
+  // -- the new ids are still bigger than all of them
+  pRoot = meld( pRoot, hp.pRoot );
+  if( pRoot )
+    pRoot->up = 0 ;
+  Base::number_of_elements += hp.number_of_elements ;
+  if( hp.last_id > Base::last_id )
+    Base::last_id = hp.last_id ;
+
+  hp.pRoot = 0 ;
+  hp.number_of_elements = 0 ;
+
+}// merge()
+
+template<typename dataType, typename Priority, typename Hooks>
+const dataType& LeftistHeap<dataType, Priority, Hooks>::top() const
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+  return **pRoot ;
+
+}// top()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LeftistHeap<dataType, Priority, Hooks>::print( ostream& os, const LeftistHeap<dataType, Priority, Hooks>::LeftNode* n, int k ) const
+{
+  for( int i = 0; i < k; ++i )
+  {
+    os << "  " ;
+  }
+
+  if( n == 0 )
+  {
+    os << '.' << endl;
+    return;
+  }
+
+  os << **n << "  ( this=" << (void*)n << ", rank=" << n->rank << ", l=" << n->left << ", r=" << n->right << ", u=" << n->up << " )" << endl;
+
+  print( os, n->left, k + 1 );
+  print( os, n->right, k + 1 );
+
+}// print()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LeftistHeap<dataType, Priority, Hooks>::print( ostream& os ) const
+{
+  os << "pRoot = " << pRoot << endl;
+  print( os, pRoot );
+
+}// print()
@@ -0,0 +1,170 @@
+/*
+ * LeftistHeap.hpp
+ *   Created on: Oct 18, 2026
+ */
+
+#ifndef MHS_CODEBLOCKS_CPP_HEAP_LEFTISTHEAP_HPP
+#define MHS_CODEBLOCKS_CPP_HEAP_LEFTISTHEAP_HPP
+
+using namespace std;
+
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "Heap.hpp"
+#include "StaticHeap.hpp"
+#include "Priority.hpp"
+#include "Hooks.hpp"
+
+/***
+  ** class LeftistHeap - a mergeable heap implemented as a leftist tree
+  **
+  **   Subclass of StaticHeap -- use HeapAdapter< LeftistHeap<dataType> > for a Heap<dataType>
+  **   'Priority' decides which of two elements comes first -- see Priority.hpp
+  **   a binary tree where each node has a higher priority than its children, and the shortest path
+  **   to a missing child is always down the right -- so the right spine has at most log(n+1) nodes
+  **   and two heaps meld along their right spines in O(log n)
+  **     - push(), pop() and priorityChange() are all melds: O(log n)
+  **     - merge() melds the whole tree of another heap in, in O(log n)
+  **   unlike LinkHeap (a complete tree in a slab of its own) the nodes are allocated one by one and linked
+  **   with pointers, so a node can move to another heap -- and its handle with it
+  **
+  **    OPERATIONS:
+  **
+  **    -  void merge( LeftistHeap& );
+  **         move all the elements of the argument into this heap, in O(log n), and leave the argument empty
+  **         the handles of both heaps stay valid, and now belong to this one
+  **         -- only if both heaps order their elements the same way: otherwise the elements of the argument are
+  **         popped and pushed again, as in StaticHeap::merge(), and its handles are lost
+  **/
+template<typename dataType, typename Priority = RuntimePriority<dataType>, typename Hooks = NoHooks >
+class LeftistHeap: public StaticHeap< LeftistHeap<dataType, Priority, Hooks>, dataType >
+{
+ private:
+  typedef StaticHeap< LeftistHeap<dataType, Priority, Hooks>, dataType > Base ;
+  friend class StaticHeap< LeftistHeap<dataType, Priority, Hooks>, dataType > ;
+
+  /***
+    ** LeftNode subclass of Heap<dataType>::Handle
+    **
+    **   rank is the length of the right spine below the node, itself included -- 0 for no node
+    **/
+  class LeftNode: public Heap<dataType>::Handle
+  {
+   public:
+    LeftNode* left;
+    LeftNode* right;
+    LeftNode* up;
+    int rank;
+
+    // CONSTRUCTOR: the element is built in place from the arguments
+    template<typename... Args>
+    LeftNode( long id, Args&&... args )
+              : Heap<dataType>::Handle( typename Heap<dataType>::InPlace(), id, std::forward<Args>(args)... ),
+                left( 0 ), right( 0 ), up( 0 ), rank( 1 ) {}
+
+  };
+  /* inner class LeftistHeap::LeftNode */
+
+  // which of two elements comes first
+  Priority priority ;
+
+  // told about the events of the heap -- see Hooks.hpp
+  Hooks hooks ;
+
+  // pointer to top element
+  LeftNode* pRoot ;
+
+  // the nodes added by append() and not yet melded -- see heapify()
+  std::vector<LeftNode*> pending ;
+
+  // the rank of a node, 0 for none
+  static int rank( const LeftNode* n ) { return n ? n->rank : 0 ; }
+
+  // link two trees into one, along their right spines -- returns the new root, whose 'up' is left to the caller
+  LeftNode* meld( LeftNode*, LeftNode* );
+
+  // detach a node, with its subtree, from its parent
+  void cut( LeftNode* );
+
+  // take a node out of the tree, with its children melded in its place
+  void detach( LeftNode* );
+
+  // restore the ranks, and the leftist shape, from a node whose right or left subtree changed up to the root
+  void fix( LeftNode* );
+
+  // duplicate the tree of another heap -- returns the copy of its root
+  LeftNode* copy( const LeftNode* );
+
+  // delete every node
+  void destroy();
+
+  // print everything below LeftNode
+  void print( ostream&, const LeftNode*, int = 0 ) const ;
+
+ protected:
+
+  // see StaticHeap.hpp
+  // the primitive operations used by StaticHeap -- siftUp() melds the node with the root if it now comes
+  // before its parent, siftDown() melds its children in its place and the node with the root
+  //
+  void siftUp( typename Heap<dataType>::Handle& );
+  void siftDown( typename Heap<dataType>::Handle& );
+  template<typename... Args>
+  typename Heap<dataType>::Handle& createNew( Args&&... args )
+  {
+    return *new LeftNode( ++Base::last_id, std::forward<Args>(args)... );
+  }
+  typename Heap<dataType>::Handle& first();
+  template<typename... Args>
+  typename Heap<dataType>::Handle& append( Args&&... args )
+  {
+    typename Heap<dataType>::Handle& h = createNew( std::forward<Args>(args)... );
+    ++Base::number_of_elements ;
+    pending.push_back( &static_cast<LeftNode&>(h) );
+    return h ;
+  }
+  void heapify();
+  template<typename Take>
+  void takeAll( Take );
+
+ public:
+
+  // usual constructor and destructor business
+  LeftistHeap( typename Heap<dataType>::compareFxn, typename Heap<dataType>::order );
+  explicit LeftistHeap( const Priority& = Priority() );
+
+  // build the heap from all the elements of an iterator range, in O(n)
+  template<typename Iterator>
+  LeftistHeap( Iterator begin, Iterator end, const Priority& p = Priority() )
+               : priority( p ), pRoot( 0 )
+  {
+    for( ; begin != end ; ++begin )
+      append( *begin );
+    heapify();
+    hooks.created( "LeftistHeap", Base::size() );
+  }
+
+  // the copy duplicates the tree directly, in O(n)
+  LeftistHeap( const LeftistHeap<dataType, Priority, Hooks>& );
+  LeftistHeap<dataType, Priority, Hooks>& operator=( const LeftistHeap<dataType, Priority, Hooks>& );
+  ~LeftistHeap();
+
+  // the Hooks object, e.g. to read what it has recorded
+  Hooks& instrumentation() { return hooks ; }
+
+  // used for debugging
+  void print( ostream& ) const ;
+
+  const dataType& top() const ;
+
+  // remove the top element, or any element -- replace the ones of StaticHeap, which need a complete tree
+  void pop();
+  void erase( typename Heap<dataType>::Handle& );
+
+  // see the class comment
+  void merge( LeftistHeap<dataType, Priority, Hooks>& );
+
+};// class LeftistHeap
+
+#endif // MHS_CODEBLOCKS_CPP_HEAP_LEFTISTHEAP_HPP
@@ -12,95 +12,103 @@
 #include "LinkHeap.hpp"
 
 /*************************************
-         LinkNode MEMBER FUNCTIONS
-     *************************************/
-
-template<typename dataType>
-LinkHeap<dataType>::LinkNode::LinkNode( const dataType& e, typename Heap<dataType>::compareFxn& f,
-                                        typename Heap<dataType>::order& o )
-                              : Heap<dataType>::Handle( f, o, e ), left( 0 ), right( 0 ), up( 0 ), pIndex( this )
-{ }// LinkNode CONSTRUCTOR
+        LinkHeap MEMBER FUNCTIONS
+    *************************************/
 
-template<typename dataType>
-void LinkHeap<dataType>::LinkNode::swap( typename Heap<dataType>::Handle& h )
+template<typename dataType, typename Priority, typename Hooks>
+LinkHeap<dataType, Priority, Hooks>::LinkHeap( typename Heap<dataType>::compareFxn f, typename Heap<dataType>::order o )
+                    : priority( f, o ), pFirst( 0 ), pLast( 0 ), indexed( 0 ), tableUsed( 0 )
 {
-  Heap<dataType>::Handle::swap( h );
-  LinkNode& n = dynamic_cast<LinkNode&>( h );
-  LinkNode* tmp = pIndex ;
-  pIndex = n.pIndex ;
-  n.pIndex = tmp ;
-
-}// LinkNode::swap()
+  hooks.created( "LinkHeap", Base::size() );
+}// LinkHeap CONSTRUCTOR
 
-/*************************************
-        LinkHeap MEMBER FUNCTIONS
-    *************************************/
+template<typename dataType, typename Priority, typename Hooks>
+LinkHeap<dataType, Priority, Hooks>::LinkHeap( const Priority& p )
+                    : priority( p ), pFirst( 0 ), pLast( 0 ), indexed( 0 ), tableUsed( 0 )
+{
+  hooks.created( "LinkHeap", Base::size() );
+}// LinkHeap CONSTRUCTOR
 
-template<typename dataType>
-LinkHeap<dataType>::LinkHeap( typename Heap<dataType>::compareFxn f, typename Heap<dataType>::order o )
-                    : Heap<dataType>( f, o ), pFirst( 0 ), pLast( 0 )
+template<typename dataType, typename Priority, typename Hooks>
+LinkHeap<dataType, Priority, Hooks>::LinkHeap( const std::vector<dataType>& v, const Priority& p )
+                    : priority( p ), pFirst( 0 ), pLast( 0 ), indexed( 0 ), tableUsed( 0 )
 {
-  cout << "Create a LinkHeap.\n" << endl;
+  std::vector<LinkNode*> nodes ;
+  for( unsigned int i = 0 ; i < v.size() ; i++ )
+    nodes.push_back( make(v[i]) );
+  build( nodes );
+  hooks.created( "LinkHeap", Base::size() );
+
 }// LinkHeap CONSTRUCTOR
 
-template<typename dataType>
-LinkHeap<dataType>::LinkHeap( const LinkHeap<dataType>& hp ) : Heap<dataType>( hp ), pFirst( 0 ), pLast( 0 )
+template<typename dataType, typename Priority, typename Hooks>
+LinkHeap<dataType, Priority, Hooks>::LinkHeap( const LinkHeap<dataType, Priority, Hooks>& hp )
+                    : Base( hp ), priority( hp.priority ), hooks( hp.hooks ), pFirst( 0 ), pLast( 0 ), indexed( 0 ), tableUsed( 0 )
 {
-  copy( hp.pFirst );
+  pFirst = copy( hp, hp.pFirst, 0 );
+  hooks.created( "LinkHeap", Base::size() );
 
 }// LinkHeap COPY CONSTRUCTOR
 
-template<typename dataType>
-LinkHeap<dataType>::~LinkHeap()
+template<typename dataType, typename Priority, typename Hooks>
+LinkHeap<dataType, Priority, Hooks>::~LinkHeap()
 {
+  hooks.destroyed( "LinkHeap", Base::size() );
   destroy( pFirst );
-  cout << "LinkHeap DESTRUCTOR called." << endl;
-  
+
 }// LinkHeap DESTRUCTOR
 
-template<typename dataType>
-LinkHeap<dataType>& LinkHeap<dataType>::operator=( const LinkHeap<dataType>& hp )
+template<typename dataType, typename Priority, typename Hooks>
+LinkHeap<dataType, Priority, Hooks>& LinkHeap<dataType, Priority, Hooks>::operator=( const LinkHeap<dataType, Priority, Hooks>& hp )
 {
-  Heap<dataType>::operator=( hp );
-  destroy( pFirst );
+  if( this == &hp )
+    return *this ;
 
-  copy( hp.pFirst );
+  destroy( pFirst );
+  pFirst = pLast = 0 ;
+  table.clear();
+  indexed = tableUsed = 0 ;
+  Base::operator=( hp );
+  priority = hp.priority ;
+  hooks = hp.hooks ;
+
+  pFirst = copy( hp, hp.pFirst, 0 );
   return *this ;
 
 }// LinkHeap ASSIGNMENT OVERLOAD
 
-template<typename dataType>
-typename LinkHeap<dataType>::LinkNode* LinkHeap<dataType>::prev() const
+template<typename dataType, typename Priority, typename Hooks>
+typename LinkHeap<dataType, Priority, Hooks>::LinkNode* LinkHeap<dataType, Priority, Hooks>::prev() const
 {
   if( pLast == pFirst )
     return pFirst ;
 
   LinkNode* ptr = pLast ;
 
-  if( ptr->up->right == ptr )
-    return ptr->up->left ; // 50 % of cases are trivial
+  if( node(ptr->up)->right == ptr->self )
+    return node( node(ptr->up)->left ) ; // 50 % of cases are trivial
 
-  while( ptr->up  &&  ptr->up->left == ptr )
-    ptr = ptr->up ; // go up while left
+  while( ptr->up  &&  node(ptr->up)->left == ptr->self )
+    ptr = node( ptr->up ) ; // go up while left
 
   if( ptr == pFirst ) // if top reached go down as far right as possible
   {
     while( ptr->right )
-      ptr = ptr->right ;
+      ptr = node( ptr->right ) ;
     return ptr ;
   }
 
-  ptr = ptr->up->left ; // jump to sibling
+  ptr = node( node(ptr->up)->left ) ; // jump to sibling
 
   while( ptr->right )
-    ptr = ptr->right ; // go to the far right
+    ptr = node( ptr->right ) ; // go to the far right
 
   return ptr ;
 
 }// prev()
 
-template<typename dataType>
-typename LinkHeap<dataType>::LinkNode* LinkHeap<dataType>::next() const
+template<typename dataType, typename Priority, typename Hooks>
+typename LinkHeap<dataType, Priority, Hooks>::LinkNode* LinkHeap<dataType, Priority, Hooks>::next() const
 {
   if( pFirst == 0 )
     return 0 ; // empty
@@ -110,13 +118,13 @@ typename LinkHeap<dataType>::LinkNode* LinkHeap<dataType>::next() const
 
   LinkNode* ptr = pLast ;
 
-  if( ptr->up->right == 0 )
-    return ptr->up ; // 50 % of all cases are trivial
+  if( node(ptr->up)->right == 0 )
+    return node( ptr->up ) ; // 50 % of all cases are trivial
 
   while( ptr->up ) // go up while right
   {
-    if( ptr->up->right == ptr )
-      ptr = ptr->up ;
+    if( node(ptr->up)->right == ptr->self )
+      ptr = node( ptr->up ) ;
     else
         break ;
   }
@@ -124,210 +132,435 @@ typename LinkHeap<dataType>::LinkNode* LinkHeap<dataType>::next() const
   if( ptr == pFirst ) // if top reached go as left as possible
   {
     while( ptr->left )
-      ptr = ptr->left ;
+      ptr = node( ptr->left ) ;
     return ptr ;
   }
 
-  ptr = ptr->up->right ; // jump to sibling
+  ptr = node( node(ptr->up)->right ) ; // jump to sibling
 
   while( ptr->left ) // go to the far left
-    ptr = ptr->left ;
+    ptr = node( ptr->left ) ;
 
   return ptr ;
   
 }// next()
 
-template<typename dataType>
-void LinkHeap<dataType>::copy( LinkHeap<dataType>::LinkNode* n )
+template<typename dataType, typename Priority, typename Hooks>
+void LinkHeap<dataType, Priority, Hooks>::exchange( LinkHeap<dataType, Priority, Hooks>::LinkNode* a, LinkHeap<dataType, Priority, Hooks>::LinkNode* b )
 {
-  if( n == 0 )
+  if( a == b )
     return ;
+  hooks.swapped();
+
+  if( a->up == b->self ) // if the nodes are adjacent, make 'a' the parent
+  {
+    LinkNode* tmp = a ;
+    a = b ;
+    b = tmp ;
+  }
+
+  unsigned int ia = a->self, aUp = a->up, aLeft = a->left, aRight = a->right ;
+  unsigned int ib = b->self, bUp = b->up, bLeft = b->left, bRight = b->right ;
+
+  if( bUp == ia ) // b moves up into the place of its parent a
+  {
+    if( aLeft == ib )
+    {
+      b->left = ia ;
+      b->right = aRight ;
+      if( aRight ) node(aRight)->up = ib ;
+    }
+    else
+    {
+      b->right = ia ;
+      b->left = aLeft ;
+      if( aLeft ) node(aLeft)->up = ib ;
+    }
+    a->up = ib ;
+  }
+  else
+  {
+    if( aUp == bUp ) // siblings - just switch the parent's children
+    {
+      LinkNode* dad = node( aUp );
+      unsigned int tmp = dad->left ;
+      dad->left = dad->right ;
+      dad->right = tmp ;
+    }
+    else if( bUp )
+    {
+      LinkNode* dad = node( bUp );
+      if( dad->left == ib ) dad->left = ia ; else dad->right = ia ;
+    }
+    a->up = bUp ;
+
+    b->left = aLeft ;
+    b->right = aRight ;
+    if( aLeft ) node(aLeft)->up = ib ;
+    if( aRight ) node(aRight)->up = ib ;
+  }
+
+  // b takes the place of a under a's old parent
+  b->up = aUp ;
+  if( aUp && aUp != bUp )
+  {
+    LinkNode* dad = node( aUp );
+    if( dad->left == ia ) dad->left = ib ; else dad->right = ib ;
+  }
+
+  // a takes the children of b
+  a->left = bLeft ;
+  a->right = bRight ;
+  if( bLeft ) node(bLeft)->up = ia ;
+  if( bRight ) node(bRight)->up = ia ;
+
+  if( pFirst == a ) pFirst = b ; else if( pFirst == b ) pFirst = a ;
+  if( pLast == a ) pLast = b ; else if( pLast == b ) pLast = a ;
+
+}// exchange()
+
+template<typename dataType, typename Priority, typename Hooks>
+typename LinkHeap<dataType, Priority, Hooks>::LinkNode* LinkHeap<dataType, Priority, Hooks>::copy( const LinkHeap<dataType, Priority, Hooks>& hp,
+                                                                                     const LinkHeap<dataType, Priority, Hooks>::LinkNode* n,
+                                                                                     LinkHeap<dataType, Priority, Hooks>::LinkNode* up )
+{
+  if( n == 0 )
+    return 0 ;
   
-  push( **n );
-  copy( n->left );
-  copy( n->right );
+  // same element and id, same place in the tree -- so no sifting
+  unsigned int i = slab.allocate();
+  LinkNode* c = new( slab[i] ) LinkNode( *n );
+  c->self = i ;
+  enter( c );
+  c->up = ref( up );
+  if( n == hp.pLast )
+    pLast = c ;
+
+  c->left = ref( copy(hp, hp.node(n->left), c) );
+  c->right = ref( copy(hp, hp.node(n->right), c) );
+  return c ;
   
 }// copy()
 
-template<typename dataType>
-void LinkHeap<dataType>::destroy( LinkHeap<dataType>::LinkNode* n )
+template<typename dataType, typename Priority, typename Hooks>
+void LinkHeap<dataType, Priority, Hooks>::build( std::vector<LinkHeap<dataType, Priority, Hooks>::LinkNode*>& nodes )
+{
+  // link the nodes as a complete tree, in level order
+  int n = nodes.size();
+  for( int i = 0 ; i < n ; i++ )
+  {
+    nodes[i]->up = i > 0 ? nodes[(i-1) / 2]->self : 0 ;
+    nodes[i]->left = 2*i + 1 < n ? nodes[2*i + 1]->self : 0 ;
+    nodes[i]->right = 2*i + 2 < n ? nodes[2*i + 2]->self : 0 ;
+  }
+  pFirst = n > 0 ? nodes[0] : 0 ;
+  pLast = n > 0 ? nodes[n-1] : 0 ;
+  Base::number_of_elements = n ;
+
+  heapify( nodes );
+
+}// build()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LinkHeap<dataType, Priority, Hooks>::heapify( std::vector<LinkHeap<dataType, Priority, Hooks>::LinkNode*>& nodes )
+{
+  // Floyd's bottom-up heapify: a sift only moves nodes inside the subtree below it,
+  // so nodes[i] is still at position i when its turn comes
+  for( int i = nodes.size()/2 - 1 ; i >= 0 ; i-- )
+    siftDown( *nodes[i] );
+
+}// heapify()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LinkHeap<dataType, Priority, Hooks>::heapify()
+{
+  // list the nodes in level order, then heapify bottom-up
+  std::vector<LinkNode*> nodes ;
+  if( pFirst )
+    nodes.push_back( pFirst );
+  for( unsigned int i = 0 ; i < nodes.size() ; i++ )
+  {
+    if( nodes[i]->left ) nodes.push_back( node(nodes[i]->left) );
+    if( nodes[i]->right ) nodes.push_back( node(nodes[i]->right) );
+  }
+  heapify( nodes );
+
+}// heapify()
+
+template<typename dataType, typename Priority, typename Hooks>
+template<typename Take>
+void LinkHeap<dataType, Priority, Hooks>::takeAll( Take take )
+{
+  std::vector<LinkNode*> nodes ;
+  if( pFirst )
+    nodes.push_back( pFirst );
+  for( unsigned int i = 0 ; i < nodes.size() ; i++ )
+  {
+    if( nodes[i]->left ) nodes.push_back( node(nodes[i]->left) );
+    if( nodes[i]->right ) nodes.push_back( node(nodes[i]->right) );
+    take( *nodes[i] );
+  }
+
+  destroy( pFirst );
+  pFirst = pLast = 0 ;
+  table.clear();
+  indexed = tableUsed = 0 ;
+
+}// takeAll()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LinkHeap<dataType, Priority, Hooks>::destroy( LinkHeap<dataType, Priority, Hooks>::LinkNode* n )
 {
   if( n == 0 )
     return;
 
-  destroy( n->left );
-  destroy( n->right );
+  destroy( node(n->left) );
+  destroy( node(n->right) );
 
-  delete n;
-  Heap<dataType>::number_of_elements = 0 ;
+  slab.release( n->self );
+  Base::number_of_elements = 0 ;
 
 }// destroy()
 
-template<typename dataType>
-typename LinkHeap<dataType>::LinkNode* LinkHeap<dataType>::getHigherPriorityChild( LinkHeap<dataType>::LinkNode* n )
+template<typename dataType, typename Priority, typename Hooks>
+typename LinkHeap<dataType, Priority, Hooks>::LinkNode* LinkHeap<dataType, Priority, Hooks>::getHigherPriorityChild( LinkHeap<dataType, Priority, Hooks>::LinkNode* n )
 {
   // if (n == 0) return 0;
-  if( n->left == 0 )
-    return n->right ;
+  LinkNode* left = node( n->left );
+  LinkNode* right = node( n->right );
+
+  if( left == 0 )
+    return right ;
 
-  if( n->right == 0 )
-    return n->left ;
+  if( right == 0 )
+    return left ;
 
-  if( n->left->higherPriority( *(n->right) ) )
-    return n->left ;
+  hooks.compared();
+  if( left->higherPriority( *right, priority ) )
+    return left ;
 
-  return n->right ;
+  return right ;
 
 }// getHigherPriorityChild()
 
-template<typename dataType>
-void LinkHeap<dataType>::siftUp( typename Heap<dataType>::Handle& h )
+template<typename dataType, typename Priority, typename Hooks>
+void LinkHeap<dataType, Priority, Hooks>::siftUp( typename Heap<dataType>::Handle& h )
 {
   LinkNode* ptr = &static_cast<LinkNode&>( h );
+  int levels = 0, nodes = 1 ;
 
   while( ptr->up != 0 )
   {
-    if( ptr->higherPriority( *(ptr->up) ) ) // element out of order
+    LinkNode* dad = node( ptr->up );
+    ++nodes ;
+    hooks.compared();
+    if( ptr->higherPriority( *dad, priority ) ) // element out of order
     {
-      ptr->swap( *(ptr->up) );
-      ptr = ptr->up ;
+      exchange( ptr, dad ); // ptr is now one level higher
+      ++levels ;
     }
     else
-        return ;
+        break ;
   }
+  hooks.sifted( SIFT_UP, levels, nodes );
+
 }// siftUp()
 
-template<typename dataType>
-void LinkHeap<dataType>::siftDown( typename Heap<dataType>::Handle& h )
+template<typename dataType, typename Priority, typename Hooks>
+void LinkHeap<dataType, Priority, Hooks>::siftDown( typename Heap<dataType>::Handle& h )
 {
   LinkNode* ptr = &static_cast<LinkNode&>( h ), *child ;
+  int levels = 0, nodes = 1 ;
 
   while( (child = getHigherPriorityChild(ptr)) != 0 )
   {
-    if( child->higherPriority(*ptr) ) // compare element to larger child
+    nodes += ptr->right ? 2 : 1 ;
+    hooks.compared();
+    if( child->higherPriority( *ptr, priority ) ) // compare element to larger child
     {
-      child->swap( *ptr );
-      ptr = child ;
+      exchange( child, ptr ); // ptr is now one level lower
+      ++levels ;
     }
     else
-        return ;
+        break ;
   }
+  hooks.sifted( SIFT_DOWN, levels, nodes );
+
 }// siftDown()
 
-template<typename dataType>
-typename Heap<dataType>::Handle& LinkHeap<dataType>::createNew( const dataType& e )
+template<typename dataType, typename Priority, typename Hooks>
+typename Heap<dataType>::Handle& LinkHeap<dataType, Priority, Hooks>::place( LinkHeap<dataType, Priority, Hooks>::LinkNode* n )
 {
-  // keep track of all the nodes
-  static LinkNode* prevNode = 0 ;
-  
   LinkNode* ptr = next();
 
-  LinkNode* n = new LinkNode( e, Heap<dataType>::comparison, Heap<dataType>::ordering );
   n->left = n->right = 0 ;
-  n->up = ptr ;
+  n->up = ref( ptr );
 
-  // each node stores an alias to the previous node created -- needed in value() to traverse the list
-  n->pPrev = prevNode ;
-  prevNode = n ;
-  
   if( ptr == 0 )
     pLast = pFirst = n ;
   else
   {
     if( ptr->left == 0 )
-      pLast = ptr->left = n ;
-    else if( ptr->right == 0 )
-        pLast = ptr->right = n ;
+      ptr->left = n->self ;
+    else
+        ptr->right = n->self ;
+    pLast = n ;
   }
   
   return *n ;
 
-}// createNew()
+}// place()
 
-template<typename dataType>
-typename Heap<dataType>::Handle& LinkHeap<dataType>::first()
+template<typename dataType, typename Priority, typename Hooks>
+typename Heap<dataType>::Handle& LinkHeap<dataType, Priority, Hooks>::first()
 {
-  if( Heap<dataType>::vide() )
+  if( Base::vide() )
     throw typename Heap<dataType>::Problem();
   return *pFirst ;
 
 }// first()
 
-template<typename dataType>
-void LinkHeap<dataType>::moveLastToFirst()
+template<typename dataType, typename Priority, typename Hooks>
+void LinkHeap<dataType, Priority, Hooks>::moveLastToFirst()
 {
-  pFirst->swap( *pLast );
+  exchange( pFirst, pLast );
 
 }// moveLastToFirst()
 
-template<typename dataType>
-void LinkHeap<dataType>::deleteLast()
+template<typename dataType, typename Priority, typename Hooks>
+void LinkHeap<dataType, Priority, Hooks>::deleteLast()
 {
   LinkNode* ptr = pLast ;
   pLast = prev();
 
   if( ptr->up )
   {
-    if( ptr->up->right == ptr )
-      ptr->up->right = 0 ;
+    LinkNode* dad = node( ptr->up );
+    if( dad->right == ptr->self )
+      dad->right = 0 ;
     else
-        ptr->up->left = 0 ;
+        dad->left = 0 ;
   }
   else
       pLast = pFirst = 0 ;
 
-  delete ptr ;
+  remove( ptr );
+  slab.release( ptr->self );
 
 }// deleteLast()
 
-template<typename dataType>
-typename Heap<dataType>::Handle& LinkHeap<dataType>::index( const typename Heap<dataType>::Handle& h ) const
+template<typename dataType, typename Priority, typename Hooks>
+typename Heap<dataType>::Handle& LinkHeap<dataType, Priority, Hooks>::moveLastTo( typename Heap<dataType>::Handle& h )
 {
-  const LinkNode& n = dynamic_cast<const LinkNode&>( h );
-  return *n.pIndex ;
+  LinkNode* moved = pLast ;
+  exchange( &static_cast<LinkNode&>(h), moved );
+  return *moved ;
 
-}// index()
+}// moveLastTo()
 
-template<typename dataType>
-typename Heap<dataType>::Handle& LinkHeap<dataType>::value( const dataType& t ) const
+template<typename dataType, typename Priority, typename Hooks>
+typename Heap<dataType>::Handle& LinkHeap<dataType, Priority, Hooks>::find( const dataType& t ) const
 {
-  if( Heap<dataType>::vide() )
+  if( Base::vide() )
     throw typename Heap<dataType>::Problem();
   
-  LinkNode* ptr = pLast ;
-  while( ptr )
+  // the index is only built when it is first needed, so a heap that never looks for a value does not pay for it
+  if( table.empty() )
   {
-    if( *const_cast<dataType&>(**ptr) == *const_cast<dataType&>(t) )
-      return *ptr ;
-
-    //cout << "pFirst= " << pFirst << " ; pLast = " << pLast << " ; ptr = " << ptr << " ; pPrev = " << ptr->pPrev << endl;
-
-    if( ptr == pFirst )
-      break ;
-    
-    ptr = ptr->pPrev ;
+    rehash( Base::size() );
+    std::vector<LinkNode*> nodes( 1, pFirst );
+    for( unsigned int i = 0 ; i < nodes.size() ; i++ )
+    {
+      enter( nodes[i] );
+      if( nodes[i]->left ) nodes.push_back( node(nodes[i]->left) );
+      if( nodes[i]->right ) nodes.push_back( node(nodes[i]->right) );
+    }
   }
+
+  // probe from the hash of the element -- the load factor is at most 1/2, so there is a free entry to stop at
+  for( unsigned int p = hash( t ) ; table[p] != 0 ; p = ( p + 1 ) & ( table.size() - 1 ) )
+    if( table[p] != REMOVED && ValueIndex<dataType>::equal( **node( table[p] ), t ) )
+      return *node( table[p] );
   
   // did NOT find the value
   throw typename Heap<dataType>::Problem();
   
-}// value()
+}// find()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LinkHeap<dataType, Priority, Hooks>::addEntry( LinkHeap<dataType, Priority, Hooks>::LinkNode* n ) const
+{
+  if( 2 * (tableUsed + 1) > (int)table.size() )
+    rehash( indexed );
+
+  unsigned int p = hash( **n );
+  while( table[p] != 0 && table[p] != REMOVED )
+    p = ( p + 1 ) & ( table.size() - 1 );
+
+  if( table[p] == 0 )
+    ++tableUsed ;
+  table[p] = n->self ;
+
+  if( n->self >= entry.size() )
+    entry.resize( 2 * n->self );
+  entry[ n->self ] = p ;
+  ++indexed ;
+
+}// addEntry()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LinkHeap<dataType, Priority, Hooks>::removeEntry( const LinkHeap<dataType, Priority, Hooks>::LinkNode* n ) const
+{
+  // the entry is found through the node, not through its value -- which may have changed, or been moved out
+  table[ entry[n->self] ] = REMOVED ;
+  --indexed ;
+
+}// removeEntry()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LinkHeap<dataType, Priority, Hooks>::rehash( int n ) const
+{
+  std::vector<unsigned int> old ;
+  old.swap( table );
+
+  // at most 1/4 full after the rehash
+  unsigned int size = 16 ;
+  while( size < 4 * (unsigned int)(n + 1) )
+    size *= 2 ;
+  table.assign( size, 0 );
+  indexed = tableUsed = 0 ;
+
+  for( unsigned int i = 0 ; i < old.size() ; i++ )
+    if( old[i] != 0 && old[i] != REMOVED )
+      enter( node(old[i]) );
+
+}// rehash()
+
+template<typename dataType, typename Priority, typename Hooks>
+void LinkHeap<dataType, Priority, Hooks>::priorityChange( typename Heap<dataType>::Handle& h )
+{
+  LinkNode* n = &static_cast<LinkNode&>( h );
+  remove( n );
+  enter( n );
+  Base::priorityChange( h );
+
+}// priorityChange()
 
-template<typename dataType>
-const dataType& LinkHeap<dataType>::top() const
+template<typename dataType, typename Priority, typename Hooks>
+const dataType& LinkHeap<dataType, Priority, Hooks>::top() const
 {
-  if( Heap<dataType>::vide() )
+  if( Base::vide() )
     throw typename Heap<dataType>::Problem();
   return **pFirst ;
 
 }// top()
 
-template<typename dataType>
-void LinkHeap<dataType>::print( ostream& os, const LinkHeap<dataType>::LinkNode* n, int k ) const
+template<typename dataType, typename Priority, typename Hooks>
+void LinkHeap<dataType, Priority, Hooks>::print( ostream& os, const LinkHeap<dataType, Priority, Hooks>::LinkNode* n, int k ) const
 {
   for( int i = 0; i < k; ++i )
   {
-    cout << "  " ;
+    os << "  " ;
   }
 
   if( n == 0 )
@@ -336,15 +569,15 @@ void LinkHeap<dataType>::print( ostream& os, const LinkHeap<dataType>::LinkNode*
     return;
   }
 
-  cout << **n << "  ( this=" << (void*)n << ", pPrev=" << n->pPrev << ", pIndex=" << n->pIndex << ", l=" << n->left << ", r=" << n->right << ", u=" << n->up << " )" << endl;
+  os << **n << "  ( this=" << (void*)n << ", slot=" << n->self << ", l=" << n->left << ", r=" << n->right << ", u=" << n->up << " )" << endl;
 
-  print( os, n->left, k + 1 );
-  print( os, n->right, k + 1 );
+  print( os, node(n->left), k + 1 );
+  print( os, node(n->right), k + 1 );
 
 }// print()
 
-template<typename dataType>
-void LinkHeap<dataType>::print( ostream& os ) const
+template<typename dataType, typename Priority, typename Hooks>
+void LinkHeap<dataType, Priority, Hooks>::print( ostream& os ) const
 {
   os << "pFirst = " << pFirst << " ; pLast = " << pLast << endl;
   print( os, pFirst );
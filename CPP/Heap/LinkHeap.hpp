@@ -15,49 +15,138 @@
 using namespace std;
 
 #include <iostream>
+#include <vector>
+#include <functional>
+#include <new>
+#include <utility>
+#include <type_traits>
 #include "Heap.hpp"
+#include "StaticHeap.hpp"
+#include "Priority.hpp"
+#include "Hooks.hpp"
+#include "Slab.hpp"
+
+// void, if all its arguments are valid types
+template<typename...>
+struct VoidOf
+{
+  typedef void type ;
+};
+
+// how LinkHeap finds the node of an element: there is no index for a dataType without a std::hash and an operator==
+template<typename dataType, typename = void>
+struct ValueIndex
+{
+  static const bool ON = false ;
+  static std::size_t hash( const dataType& ) { return 0 ; }
+  static bool equal( const dataType&, const dataType& ) { return false ; }
+};
+
+template<typename dataType>
+struct ValueIndex< dataType, typename VoidOf< decltype( std::hash<dataType>()( std::declval<const dataType&>() ) ),
+                                              decltype( std::declval<const dataType&>() == std::declval<const dataType&>() ) >::type >
+{
+  static const bool ON = true ;
+  static std::size_t hash( const dataType& t ) { return std::hash<dataType>()( t ); }
+  static bool equal( const dataType& a, const dataType& b ) { return a == b ; }
+};
 
 /***
   ** class LinkHeap - a heap implemented as a linked list
   **
   **   the Heap interface is not modified and not extended
+  **   Subclass of StaticHeap -- use HeapAdapter< LinkHeap<dataType> > for a Heap<dataType>
+  **   'Priority' decides which of two elements comes first -- see Priority.hpp
+  **   the nodes live in a Slab of the heap and link to each other by their 32-bit slab index
+  **   value() finds the node of an element in O(1), from a hash index of the nodes by value
+  **   that is built by the first value() and kept up to date from then on
+  **   -- value() is only there for a dataType with a std::hash<dataType> and an operator==: without them
+  **      the heap has no index, and does not even check for one when it adds or removes a node
   **/
-template<typename dataType>
-class LinkHeap: public Heap<dataType> 
+template<typename dataType, typename Priority = RuntimePriority<dataType>, typename Hooks = NoHooks >
+class LinkHeap: public StaticHeap< LinkHeap<dataType, Priority, Hooks>, dataType >
 {
  private:
+  typedef StaticHeap< LinkHeap<dataType, Priority, Hooks>, dataType > Base ;
+  friend class StaticHeap< LinkHeap<dataType, Priority, Hooks>, dataType > ;
   
   /***
     ** LinkNode subclass of Heap<dataType>::Handle
     ** 
     **   it inherits elem, and the unique id mechanism
+    **   a node keeps its element for life -- sifting relinks the nodes instead,
+    **   so the handle returned by push() always refers to the same element
+    **   the links are slab indices, 0 for none -- see node() and ref()
     **/
   class LinkNode: public Heap<dataType>::Handle 
   {
    public:
-    LinkNode* left;
-    LinkNode* right;
-    LinkNode* up;
-    
-    // original index (this) of the node
-    mutable LinkNode* pIndex ;
-    
-    // alias to the previous created node
-    mutable LinkNode* pPrev ;
+    unsigned int left;
+    unsigned int right;
+    unsigned int up;
+
+    // the slab index of the node itself
+    unsigned int self;
     
-    // CONSTRUCTOR
-    LinkNode( const dataType&, typename Heap<dataType>::compareFxn&, typename Heap<dataType>::order& );
-           
-    void swap( typename Heap<dataType>::Handle& );
+    // CONSTRUCTOR: the element is built in place from the arguments
+    template<typename... Args>
+    LinkNode( unsigned int i, long id, Args&&... args )
+              : Heap<dataType>::Handle( typename Heap<dataType>::InPlace(), id, std::forward<Args>(args)... ),
+                left( 0 ), right( 0 ), up( 0 ), self( i ) {}
     
   };
   /* inner class LinkHeap::LinkNode */
   
+  // which of two elements comes first
+  Priority priority ;
+
+  // told about the events of the heap -- see Hooks.hpp
+  Hooks hooks ;
+
+  // the storage of the nodes
+  Slab<LinkNode> slab ;
+
   // pointer to top element 
   LinkNode* pFirst ;
   
   // pointer to last inserted element
   LinkNode* pLast ;
+
+  // the index of the nodes by value: an open addressing hash table of slab indices,
+  // where 0 is a free entry and REMOVED one that can be reused -- empty until the first value()
+  static const unsigned int REMOVED = ~0u ;
+  mutable std::vector<unsigned int> table ;
+
+  // the entry of each node in the table, by slab index
+  mutable std::vector<unsigned int> entry ;
+
+  // the number of nodes in the index, and of entries that are not free
+  mutable int indexed ;
+  mutable int tableUsed ;
+
+  // the first entry to look at for an element -- the hash is mixed, as std::hash of an integer is often the integer itself
+  unsigned int hash( const dataType& t ) const
+  { return ( (unsigned long long)ValueIndex<dataType>::hash( t ) * 0x9E3779B97F4A7C15ull >> 32 ) & ( table.size() - 1 ); }
+
+  // add a node to the index, take it out -- nothing to do while there is no index
+  void enter( LinkNode* n ) const
+  {
+    if( ValueIndex<dataType>::ON && !table.empty() )
+      addEntry( n );
+  }
+  void remove( const LinkNode* n ) const
+  {
+    if( ValueIndex<dataType>::ON && !table.empty() )
+      removeEntry( n );
+  }
+  void addEntry( LinkNode* ) const ;
+  void removeEntry( const LinkNode* ) const ;
+
+  // the node of an element equal to the argument -- see value()
+  typename Heap<dataType>::Handle& find( const dataType& ) const ;
+
+  // rebuild the table with room for n nodes, without the removed entries
+  void rehash( int ) const ;
   
   // find where the previous element was inserted - this would be a piece of cake for array 
   LinkNode* prev() const ;
@@ -65,8 +154,36 @@ class LinkHeap: public Heap<dataType>
   // find where the next element should be added - this would be a piece of cake for array 
   LinkNode* next() const ;
 
-  // create deep copy recursively
-  void copy( LinkNode* );
+  // the node with a slab index, 0 for index 0
+  LinkNode* node( unsigned int i ) const { return i ? slab[i] : 0 ; }
+
+  // the slab index of a node, 0 for none
+  static unsigned int ref( const LinkNode* n ) { return n ? n->self : 0 ; }
+
+  // construct a new node in the slab, with the next id
+  template<typename... Args>
+  LinkNode* make( Args&&... args )
+  {
+    unsigned int i = slab.allocate();
+    LinkNode* n = new( slab[i] ) LinkNode( i, ++Base::last_id, std::forward<Args>(args)... );
+    enter( n );
+    return n ;
+  }
+
+  // put a new node at the next free position of the tree
+  typename Heap<dataType>::Handle& place( LinkNode* );
+
+  // exchange the positions of two nodes in the tree, leaving their elements in place
+  void exchange( LinkNode*, LinkNode* );
+
+  // create deep copy recursively of a node of another heap -- returns the copy of the node
+  LinkNode* copy( const LinkHeap<dataType, Priority, Hooks>&, const LinkNode*, LinkNode* );
+
+  // link the nodes into a complete tree and heapify it bottom-up
+  void build( std::vector<LinkNode*>& );
+
+  // heapify the nodes, listed in level order
+  void heapify( std::vector<LinkNode*>& );
 
   // destroy recursively below LinkNode
   void destroy( LinkNode* );
@@ -79,30 +196,73 @@ class LinkHeap: public Heap<dataType>
 
  protected:
   
-  // see Heap.hpp
-  // pure virtual methods implemented
+  // see StaticHeap.hpp
+  // the primitive operations used by StaticHeap
   //
   void siftUp( typename Heap<dataType>::Handle& );
   void siftDown( typename Heap<dataType>::Handle& );
-  typename Heap<dataType>::Handle& createNew( const dataType& );
+  template<typename... Args>
+  typename Heap<dataType>::Handle& createNew( Args&&... args )
+  {
+    return place( make(std::forward<Args>(args)...) );
+  }
   typename Heap<dataType>::Handle& first();
   void moveLastToFirst();
   void deleteLast();
-  typename Heap<dataType>::Handle& index( const typename Heap<dataType>::Handle& ) const ;
-  typename Heap<dataType>::Handle& value( const dataType& ) const ;
+  typename Heap<dataType>::Handle& moveLastTo( typename Heap<dataType>::Handle& );
+  template<typename... Args>
+  typename Heap<dataType>::Handle& append( Args&&... args )
+  {
+    typename Heap<dataType>::Handle& h = createNew( std::forward<Args>(args)... );
+    ++Base::number_of_elements ;
+    return h ;
+  }
+  void heapify();
+  template<typename Take>
+  void takeAll( Take );
   
  public:
 
   // usual constructor and destructor business
   LinkHeap( typename Heap<dataType>::compareFxn, typename Heap<dataType>::order );
-  LinkHeap( const LinkHeap<dataType>& );
-  LinkHeap<dataType>& operator=( const LinkHeap<dataType>& );
+  explicit LinkHeap( const Priority& = Priority() );
+
+  // build the heap from all the elements of a vector or of an iterator range, in O(n)
+  LinkHeap( const std::vector<dataType>&, const Priority& = Priority() );
+
+  template<typename Iterator>
+  LinkHeap( Iterator begin, Iterator end, const Priority& p = Priority() )
+            : priority( p ), pFirst( 0 ), pLast( 0 ), indexed( 0 ), tableUsed( 0 )
+  {
+    std::vector<LinkNode*> nodes ;
+    for( ; begin != end ; ++begin )
+      nodes.push_back( make(*begin) );
+    build( nodes );
+    hooks.created( "LinkHeap", Base::size() );
+  }
+
+  // the copy duplicates the tree directly, in O(n)
+  LinkHeap( const LinkHeap<dataType, Priority, Hooks>& );
+  LinkHeap<dataType, Priority, Hooks>& operator=( const LinkHeap<dataType, Priority, Hooks>& );
   ~LinkHeap();
 
+  // the Hooks object, e.g. to read what it has recorded
+  Hooks& instrumentation() { return hooks ; }
+
   // used for debugging
   void print( ostream& ) const ;
 
   const dataType& top() const ;
+
+  // the handle of an element equal to the argument, in O(1) -- throws a Problem if there is none
+  //   only for a dataType with a std::hash and an operator== -- see the class comment
+  template<typename T = dataType>
+  typename std::enable_if< ValueIndex<T>::ON, typename Heap<dataType>::Handle& >::type value( const T& t ) const
+  { return find( t ); }
+
+  // see StaticHeap.hpp -- the element may have a new value, so its entry in the index moves as well
+  using Base::priorityChange ;
+  void priorityChange( typename Heap<dataType>::Handle& );
   
 };// class LinkHeap
 
@@ -17,6 +17,7 @@
 #include "Heap.hpp"
 #include "ArrayHeap.hpp"
 #include "LinkHeap.hpp"
+#include "PairingHeap.hpp"
 
 const int DEFAULT_VALUE = 9999 ;
 const int DEFAULT_NUM_VALUES = 17 ;
@@ -57,10 +58,14 @@ int main( int argc, char* argv[] )
   /* create a LINKED LIST heap, of template type 'TestType',
 	   with 'lt' as the compareFxn and 'SMALLER_FIRST' as the ordering  */
   //LinkHeap<TestType> myHeap( lt, Heap<TestType>::SMALLER_FIRST );
+
+  /* or a PAIRING heap */
+  //PairingHeap<TestType> myHeap( lt, Heap<TestType>::SMALLER_FIRST );
   
   /* create an ARRAY heap, of template type 'TestType',
-     with 'lt' as the compareFxn and 'SMALLER_FIRST' as the ordering  */
-  ArrayHeap<TestType> myHeap( lt, Heap<TestType>::SMALLER_FIRST );
+     with 'lt' as the compareFxn and 'SMALLER_FIRST' as the ordering,
+     that logs its construction and destruction to clog  */
+  ArrayHeap< TestType, 2, RuntimePriority<TestType>, LogHooks > myHeap( lt, Heap<TestType>::SMALLER_FIRST );
   
   // push the command line values onto the heap
   for( int i=1; i < argc; ++i )
@@ -99,7 +104,7 @@ int main( int argc, char* argv[] )
   cout << "-----------------------------------------------------------" << endl;
 
   // print each node in the heap then destroy it and recover the memory
-  while( myHeap. )
+  while( !myHeap.vide() )
   {
 	  cout << myHeap.top() << ' ' ;
 	  myHeap.pop();
@@ -0,0 +1,156 @@
+/*
+ * MultiQueue.cpp
+ *   Created on: Oct 18, 2026
+ */
+
+#include "MultiQueue.hpp"
+
+// CONSTRUCTOR: for a RuntimePriority
+template<typename dataType, int arity, typename Priority>
+MultiQueue<dataType, arity, Priority>::MultiQueue( typename Heap<dataType>::compareFxn f, typename Heap<dataType>::order o,
+                                                   int threads, int factor )
+                                                   : priority( f, o ), count( 0 )
+{
+	init( threads * factor );
+}
+
+// CONSTRUCTOR: same, with the Priority object given directly
+template<typename dataType, int arity, typename Priority>
+MultiQueue<dataType, arity, Priority>::MultiQueue( int threads, const Priority& p, int factor )
+                                                   : priority( p ), count( 0 )
+{
+	init( threads * factor );
+}
+
+// DESTRUCTOR
+template<typename dataType, int arity, typename Priority>
+MultiQueue<dataType, arity, Priority>::~MultiQueue()
+{
+	for( unsigned int i = 0 ; i < heaps.size() ; i++ )
+	  delete heaps[i] ;
+}
+
+// init(): at least two heaps, so that a pop has a choice
+template<typename dataType, int arity, typename Priority>
+void MultiQueue<dataType, arity, Priority>::init( int n )
+{
+	if( n < 2 )
+	  n = 2 ;
+	for( int i = 0 ; i < n ; i++ )
+	  heaps.push_back( new Queue(priority) );
+}
+
+// random(): xorshift, one generator per thread so the threads do not share a cache line for it
+template<typename dataType, int arity, typename Priority>
+int MultiQueue<dataType, arity, Priority>::random( int n )
+{
+	static std::atomic<unsigned int> seeds( 0 );
+	thread_local unsigned int x = 2463534242u + 0x9e3779b9u * ++seeds ;
+
+	x ^= x << 13 ;
+	x ^= x >> 17 ;
+	x ^= x << 5 ;
+	return x % n ;
+}
+
+// lockRandom(): skip the heaps that another thread holds right now
+//   but do not spin on them forever: the threads holding them may be waiting for this core
+template<typename dataType, int arity, typename Priority>
+typename MultiQueue<dataType, arity, Priority>::Queue& MultiQueue<dataType, arity, Priority>::lockRandom()
+{
+	for( int tries = 1 ; ; tries++ )
+	{
+		Queue& q = *heaps[ random(heaps.size()) ];
+		if( q.lock.try_lock() )
+		  return q ;
+		if( tries % MULTIQUEUE_SPINS == 0 )
+		  std::this_thread::yield();
+	}
+}
+
+// push()
+//   the count changes under the lock of the heap, so it is never below the number of elements that can be found
+template<typename dataType, int arity, typename Priority>
+void MultiQueue<dataType, arity, Priority>::push( const dataType& e )
+{
+	Queue& q = lockRandom();
+	q.heap.push( e );
+	++count ;
+	q.lock.unlock();
+}
+
+// push(): moving the element in
+template<typename dataType, int arity, typename Priority>
+void MultiQueue<dataType, arity, Priority>::push( dataType&& e )
+{
+	Queue& q = lockRandom();
+	q.heap.push( std::move(e) );
+	++count ;
+	q.lock.unlock();
+}
+
+// tryPop(): lock two random heaps and pop the better of their tops
+//   if both happen to be empty, the other heaps are searched before reporting that there is nothing left
+template<typename dataType, int arity, typename Priority>
+bool MultiQueue<dataType, arity, Priority>::tryPop( dataType& e )
+{
+	while( count.load(std::memory_order_relaxed) > 0 )
+	{
+		Queue& a = lockRandom();
+		Queue* b = heaps[ random(heaps.size()) ];
+		if( b == &a || !b->lock.try_lock() )
+		  b = 0 ;
+
+		// the heap with the higher priority top
+		Queue* best = a.heap.vide() ? 0 : &a ;
+		if( b && !b->heap.vide() && ( best == 0 || priority(b->heap.top(), 0, best->heap.top(), 0) ) )
+		  best = b ;
+
+		if( best )
+		{
+			e = best->heap.popValue();
+			--count ;
+		}
+		if( b )
+		  b->lock.unlock();
+		a.lock.unlock();
+
+		if( best )
+		  return true ;
+		if( b )
+		  return scan( e );
+	}
+	return false ;
+}
+
+// scan()
+template<typename dataType, int arity, typename Priority>
+bool MultiQueue<dataType, arity, Priority>::scan( dataType& e )
+{
+	for( unsigned int i = 0 ; i < heaps.size() ; i++ )
+	{
+		std::lock_guard<std::mutex> guard( heaps[i]->lock );
+		if( !heaps[i]->heap.vide() )
+		{
+			e = heaps[i]->heap.popValue();
+			--count ;
+			return true ;
+		}
+	}
+	return false ;
+}
+
+// vide()
+template<typename dataType, int arity, typename Priority>
+bool MultiQueue<dataType, arity, Priority>::vide() const
+{ return count.load() == 0 ; }
+
+// size()
+template<typename dataType, int arity, typename Priority>
+int MultiQueue<dataType, arity, Priority>::size() const
+{ return count.load(); }
+
+// queues(): the number of heaps
+template<typename dataType, int arity, typename Priority>
+int MultiQueue<dataType, arity, Priority>::queues() const
+{ return heaps.size(); }
@@ -0,0 +1,102 @@
+/*
+ * MultiQueue.hpp
+ *   Created on: Oct 18, 2026
+ */
+
+#ifndef MHS_CODEBLOCKS_CPP_HEAP_MULTIQUEUE_HPP
+#define MHS_CODEBLOCKS_CPP_HEAP_MULTIQUEUE_HPP
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Heap.hpp"
+#include "ArrayHeap.hpp"
+#include "Priority.hpp"
+
+// the number of heaps per thread
+const int MULTIQUEUE_FACTOR = 2 ;
+
+// the failed tries to lock a random heap before a thread gives up the rest of its time slice
+//   when every heap is held -- more threads than cores, or a thread preempted with a lock -- spinning only
+//   keeps the holders off the cores they need to finish
+const int MULTIQUEUE_SPINS = 8 ;
+
+/***
+  **  MultiQueue class
+  **
+  **    - a RELAXED priority queue for many threads: 'factor' x 'threads' ArrayHeaps, each with its own lock
+  **    - push() goes to a random heap, pop() looks at the tops of two random heaps and takes the better one
+  **    - a pop does not always return THE highest priority element, but one that is close to it:
+  **      the expected rank error is O(number of heaps) -- in exchange the threads hardly ever
+  **      wait for each other, as two of them rarely pick the same heap
+  **    - there are no handles, as an element cannot be found again without locking its heap
+  **
+  **    OPERATIONS:
+  **
+  **    -  void push( const dataType& );
+  **    -  void push( dataType&& );
+  **         insert a new element into a random heap
+  **
+  **    -  bool tryPop( dataType& );
+  **         move a high priority element into the argument and remove it -- false if all the heaps are empty
+  **
+  **    -  bool vide() const ;
+  **    -  int size() const ;
+  **         the number of elements, exact whenever no push() or tryPop() is running
+  **
+  **    -  int queues() const ;
+  **         the number of heaps
+  **
+  ***/
+template<typename dataType, int arity = 2, typename Priority = RuntimePriority<dataType> >
+class MultiQueue
+{
+ private:
+	// a heap and its lock, allocated one by one -- the padding keeps the next one off their cache lines
+	struct Queue
+	{
+		std::mutex lock ;
+		ArrayHeap<dataType, arity, Priority> heap ;
+		char pad[ 64 ];
+
+		Queue( const Priority& p ) : heap( p ) {}
+	};
+
+	// to compare the tops of two heaps
+	Priority priority ;
+
+	std::vector<Queue*> heaps ;
+
+	// the number of elements in all the heaps
+	std::atomic<int> count ;
+
+	// create the heaps
+	void init( int );
+
+	// lock a random heap, yielding after every MULTIQUEUE_SPINS failed tries
+	Queue& lockRandom();
+
+	// lock every heap in turn until one has an element -- the slow path of tryPop()
+	bool scan( dataType& );
+
+	// a random number below n, from a generator of the calling thread
+	static int random( int n );
+
+ public:
+	// CONSTRUCTORS: for 'threads' threads, with 'factor' heaps each
+	MultiQueue( typename Heap<dataType>::compareFxn, typename Heap<dataType>::order, int threads, int factor = MULTIQUEUE_FACTOR );
+	explicit MultiQueue( int threads, const Priority& = Priority(), int factor = MULTIQUEUE_FACTOR );
+
+	~MultiQueue();
+
+	void push( const dataType& );
+	void push( dataType&& );
+	bool tryPop( dataType& );
+	bool vide() const ;
+	int size() const ;
+	int queues() const ;
+
+};// class MultiQueue
+
+#endif // MHS_CODEBLOCKS_CPP_HEAP_MULTIQUEUE_HPP
@@ -0,0 +1,196 @@
+/*
+ * MultiQueueBench.cpp
+ *   Created on: Oct 18, 2026
+ *
+ *   throughput and rank error of the MultiQueue, against one ArrayHeap behind a mutex
+ *   and the flat-combining ConcurrentHeap
+ *
+ *   usage: MultiQueueBench [ max_threads [ operations [ initial_size ] ] ]
+ *   prints CSV: structure,threads,queues,mops_per_s,mean_rank_error,max_rank_error
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// the templates are compiled here for 'long' -- see Instance.cpp
+#include "Heap.cpp"
+#include "StaticHeap.cpp"
+#include "ArrayHeap.cpp"
+#include "ConcurrentHeap.cpp"
+#include "MultiQueue.cpp"
+
+typedef StaticPriority<long> LongPriority ;
+typedef ArrayHeap<long, 4, LongPriority> LongHeap ;
+
+// the keys are drawn from [0, KEY_RANGE)
+const long KEY_RANGE = 1 << 20 ;
+
+// a random key from a generator of the calling thread
+long randomKey( unsigned int& x )
+{
+  x ^= x << 13 ;
+  x ^= x >> 17 ;
+  x ^= x << 5 ;
+  return x % KEY_RANGE ;
+}
+
+/* Fenwick tree over the keys: the number of stored keys below a key, in O(log KEY_RANGE),
+   which is the rank error of popping that key when the smallest comes first */
+class RankCounter
+{
+ private:
+  std::vector<int> tree ;
+
+ public:
+  RankCounter() : tree( KEY_RANGE + 1, 0 ) {}
+
+  void add( long key, int d )
+  {
+    for( long i = key + 1 ; i <= KEY_RANGE ; i += i & -i )
+      tree[i] += d ;
+  }
+
+  int below( long key ) const
+  {
+    int n = 0 ;
+    for( long i = key ; i > 0 ; i -= i & -i )
+      n += tree[i] ;
+    return n ;
+  }
+};
+
+// one ArrayHeap and a mutex -- the strict baseline
+class LockedHeap
+{
+ private:
+  std::mutex lock ;
+  LongHeap heap ;
+
+ public:
+  void push( long k )
+  {
+    std::lock_guard<std::mutex> guard( lock );
+    heap.push( k );
+  }
+
+  bool tryPop( long& k )
+  {
+    std::lock_guard<std::mutex> guard( lock );
+    if( heap.vide() )
+      return false ;
+    k = heap.popValue();
+    return true ;
+  }
+};
+
+// each thread repeats: pop one element, push a new random one -- so the size stays the same
+template<typename Queue>
+double throughput( Queue& q, int threads, long operations, int initial )
+{
+  unsigned int seed = 12345 ;
+  for( int i = 0 ; i < initial ; i++ )
+    q.push( randomKey(seed) );
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers ;
+  for( int t = 0 ; t < threads ; t++ )
+    workers.push_back( std::thread( [&q, t, threads, operations]()
+    {
+      unsigned int x = 2463534242u + 7919u * t ;
+      long k ;
+      for( long i = 0 ; i < operations / threads / 2 ; i++ )
+      {
+        q.tryPop( k );
+        q.push( randomKey(x) );
+      }
+    } ) );
+  for( unsigned int t = 0 ; t < workers.size() ; t++ )
+    workers[t].join();
+
+  std::chrono::duration<double> s = std::chrono::steady_clock::now() - start ;
+  return operations / s.count() / 1e6 ;
+}
+
+/* the same workload, with every operation also recorded in a RankCounter under one global lock:
+   that serializes the threads, but the error that comes from choosing random heaps is measured exactly */
+void rankError( MultiQueue<long, 4, LongPriority>& q, int threads, long operations, int initial, double& mean, int& worst )
+{
+  RankCounter ranks ;
+  std::mutex oracle ;
+  unsigned int seed = 12345 ;
+  for( int i = 0 ; i < initial ; i++ )
+  {
+    long k = randomKey( seed );
+    q.push( k );
+    ranks.add( k, 1 );
+  }
+
+  long pops = 0, total = 0 ;
+  worst = 0 ;
+  std::vector<std::thread> workers ;
+  for( int t = 0 ; t < threads ; t++ )
+    workers.push_back( std::thread( [&, t]()
+    {
+      unsigned int x = 2463534242u + 7919u * t ;
+      long k ;
+      for( long i = 0 ; i < operations / threads / 2 ; i++ )
+      {
+        std::lock_guard<std::mutex> guard( oracle );
+        if( q.tryPop(k) )
+        {
+          ranks.add( k, -1 );
+          int r = ranks.below( k );
+          total += r ;
+          ++pops ;
+          if( r > worst )
+            worst = r ;
+        }
+        k = randomKey( x );
+        q.push( k );
+        ranks.add( k, 1 );
+      }
+    } ) );
+  for( unsigned int t = 0 ; t < workers.size() ; t++ )
+    workers[t].join();
+
+  mean = pops ? double( total ) / pops : 0 ;
+}
+
+int main( int argc, char* argv[] )
+{
+  int maxThreads = argc > 1 ? atoi( argv[1] ) : 16 ;
+  long operations = argc > 2 ? atol( argv[2] ) : 4000000 ;
+  int initial = argc > 3 ? atoi( argv[3] ) : 1000000 ;
+
+  cout << "# hardware threads: " << std::thread::hardware_concurrency() << endl;
+  cout << "structure,threads,queues,mops_per_s,mean_rank_error,max_rank_error" << endl;
+
+  for( int threads = 1 ; threads <= maxThreads ; threads *= 2 )
+  {
+    {
+      LockedHeap q ;
+      double m = throughput( q, threads, operations, initial );
+      cout << "mutex," << threads << ",1," << m << ",0,0" << endl;
+    }
+    {
+      ConcurrentHeap<LongHeap> q ;
+      double m = throughput( q, threads, operations, initial );
+      cout << "flat_combining," << threads << ",1," << m << ",0,0" << endl;
+    }
+    {
+      MultiQueue<long, 4, LongPriority> q( threads );
+      double m = throughput( q, threads, operations, initial );
+
+      MultiQueue<long, 4, LongPriority> r( threads );
+      double mean ;
+      int worst ;
+      rankError( r, threads, operations, initial, mean, worst );
+      cout << "multiqueue," << threads << ',' << q.queues() << ',' << m << ',' << mean << ',' << worst << endl;
+    }
+  }
+  return 0 ;
+}
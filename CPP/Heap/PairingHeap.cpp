@@ -0,0 +1,391 @@
+/*
+ * PairingHeap.cpp
+ *   Created on: Oct 18, 2026
+ */
+
+#include "PairingHeap.hpp"
+
+/*************************************
+        PairingHeap MEMBER FUNCTIONS
+    *************************************/
+
+template<typename dataType, typename Priority, typename Hooks>
+PairingHeap<dataType, Priority, Hooks>::PairingHeap( typename Heap<dataType>::compareFxn f, typename Heap<dataType>::order o )
+                    : priority( f, o ), pRoot( 0 )
+{
+  hooks.created( "PairingHeap", 0 );
+}// PairingHeap CONSTRUCTOR
+
+template<typename dataType, typename Priority, typename Hooks>
+PairingHeap<dataType, Priority, Hooks>::PairingHeap( const Priority& p )
+                    : priority( p ), pRoot( 0 )
+{
+  hooks.created( "PairingHeap", 0 );
+}// PairingHeap CONSTRUCTOR
+
+template<typename dataType, typename Priority, typename Hooks>
+PairingHeap<dataType, Priority, Hooks>::PairingHeap( const PairingHeap<dataType, Priority, Hooks>& hp )
+                    : Base( hp ), priority( hp.priority ), hooks( hp.hooks ), pRoot( 0 )
+{
+  hooks.created( "PairingHeap", Base::size() );
+  pRoot = copy( hp );
+
+}// PairingHeap COPY CONSTRUCTOR
+
+template<typename dataType, typename Priority, typename Hooks>
+PairingHeap<dataType, Priority, Hooks>::~PairingHeap()
+{
+  hooks.destroyed( "PairingHeap", Base::size() );
+  destroy();
+
+}// PairingHeap DESTRUCTOR
+
+template<typename dataType, typename Priority, typename Hooks>
+PairingHeap<dataType, Priority, Hooks>& PairingHeap<dataType, Priority, Hooks>::operator=( const PairingHeap<dataType, Priority, Hooks>& hp )
+{
+  if( this == &hp )
+    return *this ;
+
+  destroy();
+  Base::operator=( hp );
+  priority = hp.priority ;
+  hooks = hp.hooks ;
+
+  pRoot = copy( hp );
+  return *this ;
+
+}// PairingHeap ASSIGNMENT OVERLOAD
+
+template<typename dataType, typename Priority, typename Hooks>
+typename PairingHeap<dataType, Priority, Hooks>::PairNode* PairingHeap<dataType, Priority, Hooks>::meld( PairingHeap<dataType, Priority, Hooks>::PairNode* a,
+                                                                                          PairingHeap<dataType, Priority, Hooks>::PairNode* b )
+{
+  if( a == 0 )
+    return b ;
+  if( b == 0 )
+    return a ;
+
+  hooks.compared();
+  if( b->higherPriority( *a, priority ) )
+  {
+    PairNode* tmp = a ;
+    a = b ;
+    b = tmp ;
+  }
+
+  // b goes in front of the children of a
+  b->next = a->child ;
+  if( a->child )
+    node(a->child)->prev = b->self ;
+  b->prev = a->self ;
+  a->child = b->self ;
+  return a ;
+
+}// meld()
+
+template<typename dataType, typename Priority, typename Hooks>
+void PairingHeap<dataType, Priority, Hooks>::cut( PairingHeap<dataType, Priority, Hooks>::PairNode* n )
+{
+  if( n->prev )
+  {
+    PairNode* p = node( n->prev );
+    if( p->child == n->self )
+      p->child = n->next ;
+    else
+        p->next = n->next ;
+  }
+  if( n->next )
+    node(n->next)->prev = n->prev ;
+
+  n->prev = n->next = 0 ;
+
+}// cut()
+
+template<typename dataType, typename Priority, typename Hooks>
+typename PairingHeap<dataType, Priority, Hooks>::PairNode* PairingHeap<dataType, Priority, Hooks>::combine( unsigned int first )
+{
+  if( first == 0 )
+    return 0 ;
+
+  // first pass: meld the siblings two by two, from the left
+  pairs.clear();
+  PairNode* a = node( first );
+  while( a )
+  {
+    PairNode* b = node( a->next );
+    PairNode* rest = b ? node( b->next ) : 0 ;
+
+    a->prev = a->next = 0 ;
+    if( b )
+      b->prev = b->next = 0 ;
+    pairs.push_back( meld(a, b) );
+    a = rest ;
+  }
+
+  // second pass: meld the pairs into one tree, from the right
+  PairNode* t = pairs.back();
+  for( int i = pairs.size() - 2 ; i >= 0 ; i-- )
+    t = meld( pairs[i], t );
+  return t ;
+
+}// combine()
+
+template<typename dataType, typename Priority, typename Hooks>
+void PairingHeap<dataType, Priority, Hooks>::detach( PairingHeap<dataType, Priority, Hooks>::PairNode* n )
+{
+  PairNode* rest = combine( n->child );
+  n->child = 0 ;
+  if( n == pRoot )
+    pRoot = rest ;
+  else
+  {
+    cut( n );
+    pRoot = meld( pRoot, rest );
+  }
+
+}// detach()
+
+template<typename dataType, typename Priority, typename Hooks>
+typename PairingHeap<dataType, Priority, Hooks>::PairNode* PairingHeap<dataType, Priority, Hooks>::copy( const PairingHeap<dataType, Priority, Hooks>& hp )
+{
+  if( hp.pRoot == 0 )
+    return 0 ;
+
+  // same elements and ids, same shape -- with a list of the nodes still to do instead of recursion,
+  // as a long list of siblings would be as deep
+  std::vector< std::pair<const PairNode*, PairNode*> > todo ;
+  PairNode* root = 0 ;
+  todo.push_back( std::make_pair(hp.pRoot, (PairNode*)0) );
+  while( !todo.empty() )
+  {
+    const PairNode* n = todo.back().first ;
+    PairNode* from = todo.back().second ;
+    todo.pop_back();
+
+    unsigned int i = slab.allocate();
+    PairNode* c = new( slab[i] ) PairNode( *n );
+    c->self = i ;
+    c->child = c->next = 0 ;
+    c->prev = ref( from );
+    if( from == 0 )
+      root = c ;
+    else if( hp.node(n->prev)->child == n->self ) // n is the first child of the node it hangs from
+      from->child = i ;
+    else
+        from->next = i ;
+
+    if( n->next )
+      todo.push_back( std::make_pair(hp.node(n->next), c) );
+    if( n->child )
+      todo.push_back( std::make_pair(hp.node(n->child), c) );
+  }
+  return root ;
+
+}// copy()
+
+template<typename dataType, typename Priority, typename Hooks>
+void PairingHeap<dataType, Priority, Hooks>::destroy()
+{
+  std::vector<PairNode*> todo ;
+  if( pRoot )
+    todo.push_back( pRoot );
+  while( !todo.empty() )
+  {
+    PairNode* n = todo.back();
+    todo.pop_back();
+    if( n->child ) todo.push_back( node(n->child) );
+    if( n->next ) todo.push_back( node(n->next) );
+    slab.release( n->self );
+  }
+  pRoot = 0 ;
+  Base::number_of_elements = 0 ;
+
+}// destroy()
+
+template<typename dataType, typename Priority, typename Hooks>
+void PairingHeap<dataType, Priority, Hooks>::siftUp( typename Heap<dataType>::Handle& h )
+{
+  PairNode* n = &static_cast<PairNode&>( h );
+  if( n == pRoot )
+    return ;
+
+  // the subtree is still in order below n -- only its link to the parent may not be
+  cut( n );
+  pRoot = meld( pRoot, n );
+
+}// siftUp()
+
+template<typename dataType, typename Priority, typename Hooks>
+void PairingHeap<dataType, Priority, Hooks>::siftDown( typename Heap<dataType>::Handle& h )
+{
+  PairNode* n = &static_cast<PairNode&>( h );
+
+  // the children of n may now come before it: meld them into one tree in its place, and n on its own
+  detach( n );
+  pRoot = meld( pRoot, n );
+
+}// siftDown()
+
+template<typename dataType, typename Priority, typename Hooks>
+typename Heap<dataType>::Handle& PairingHeap<dataType, Priority, Hooks>::first()
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+  return *pRoot ;
+
+}// first()
+
+template<typename dataType, typename Priority, typename Hooks>
+void PairingHeap<dataType, Priority, Hooks>::heapify()
+{
+  // nothing to do: append() has already melded each new node with the root
+
+}// heapify()
+
+template<typename dataType, typename Priority, typename Hooks>
+template<typename Take>
+void PairingHeap<dataType, Priority, Hooks>::takeAll( Take take )
+{
+  std::vector<PairNode*> todo ;
+  if( pRoot )
+    todo.push_back( pRoot );
+  while( !todo.empty() )
+  {
+    PairNode* n = todo.back();
+    todo.pop_back();
+    if( n->child ) todo.push_back( node(n->child) );
+    if( n->next ) todo.push_back( node(n->next) );
+    take( *n );
+  }
+  destroy();
+
+}// takeAll()
+
+template<typename dataType, typename Priority, typename Hooks>
+void PairingHeap<dataType, Priority, Hooks>::pop()
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+
+  PairNode* old = pRoot ;
+  pRoot = combine( old->child );
+  slab.release( old->self );
+  --Base::number_of_elements ;
+
+}// pop()
+
+template<typename dataType, typename Priority, typename Hooks>
+void PairingHeap<dataType, Priority, Hooks>::erase( typename Heap<dataType>::Handle& h )
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+
+  PairNode* n = &static_cast<PairNode&>( h );
+  detach( n );
+  slab.release( n->self );
+  --Base::number_of_elements ;
+
+}// erase()
+
+template<typename dataType, typename Priority, typename Hooks>
+void PairingHeap<dataType, Priority, Hooks>::priorityChange( typename Heap<dataType>::Handle& h )
+{
+  // the priority may have gone either way -- siftDown() puts the node back in order in both cases
+  siftDown( h );
+
+}// priorityChange()
+
+template<typename dataType, typename Priority, typename Hooks>
+void PairingHeap<dataType, Priority, Hooks>::priorityChange( typename Heap<dataType>::Handle& h, const dataType& e )
+{
+  // same id for both, so equal elements compare as 'not higher'
+  hooks.compared();
+  bool lower = priority( *h, 0, e, 0 );
+  Base::element( h ) = e ;
+
+  if( lower )
+    siftDown( h );
+  else
+      siftUp( h );
+
+}// priorityChange()
+
+template<typename dataType, typename Priority, typename Hooks>
+void PairingHeap<dataType, Priority, Hooks>::merge( PairingHeap<dataType, Priority, Hooks>& hp )
+{
+  if( this == &hp )
+    return ;
+
+  // a tree in another order cannot be melded into ours
+  if( !( priority == hp.priority ) )
+  {
+    Base::merge( hp );
+    return ;
+  }
+
+  // the nodes of hp do not move: only their slab indices do, and the ids of hp follow ours, so its equal
+  // elements keep their order, behind ours
+  unsigned int offset = slab.adopt( hp.slab );
+  std::vector<PairNode*> todo ;
+  if( hp.pRoot )
+    todo.push_back( hp.pRoot );
+  while( !todo.empty() )
+  {
+    PairNode* n = todo.back();
+    todo.pop_back();
+    n->self += offset ;
+    if( n->prev ) n->prev += offset ;
+    if( n->child )
+    {
+      n->child += offset ;
+      todo.push_back( node(n->child) );
+    }
+    if( n->next )
+    {
+      n->next += offset ;
+      todo.push_back( node(n->next) );
+    }
+    Base::renumber( *n, Base::last_id );
+  }
+
+  pRoot = meld( pRoot, hp.pRoot );
+  Base::number_of_elements += hp.number_of_elements ;
+  Base::last_id += hp.last_id ;
+
+  hp.pRoot = 0 ;
+  hp.number_of_elements = 0 ;
+
+}// merge()
+
+template<typename dataType, typename Priority, typename Hooks>
+const dataType& PairingHeap<dataType, Priority, Hooks>::top() const
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+  return **pRoot ;
+
+}// top()
+
+template<typename dataType, typename Priority, typename Hooks>
+void PairingHeap<dataType, Priority, Hooks>::print( ostream& os, const PairingHeap<dataType, Priority, Hooks>::PairNode* n, int k ) const
+{
+  for( ; n ; n = node(n->next) )
+  {
+    for( int i = 0; i < k; ++i )
+    {
+      os << "  " ;
+    }
+    os << **n << "  ( this=" << (void*)n << ", slot=" << n->self << ", c=" << n->child << ", n=" << n->next << ", p=" << n->prev << " )" << endl;
+
+    print( os, node(n->child), k + 1 );
+  }
+
+}// print()
+
+template<typename dataType, typename Priority, typename Hooks>
+void PairingHeap<dataType, Priority, Hooks>::print( ostream& os ) const
+{
+  os << "pRoot = " << pRoot << endl;
+  print( os, pRoot );
+
+}// print()
@@ -0,0 +1,190 @@
+/*
+ * PairingHeap.hpp
+ *   Created on: Oct 18, 2026
+ */
+
+#ifndef MHS_CODEBLOCKS_CPP_HEAP_PAIRINGHEAP_HPP
+#define MHS_CODEBLOCKS_CPP_HEAP_PAIRINGHEAP_HPP
+
+using namespace std;
+
+#include <iostream>
+#include <vector>
+#include <new>
+#include <utility>
+#include "Heap.hpp"
+#include "StaticHeap.hpp"
+#include "Priority.hpp"
+#include "Hooks.hpp"
+#include "Slab.hpp"
+
+/***
+  ** class PairingHeap - a heap implemented as a pairing heap
+  **
+  **   Subclass of StaticHeap -- use HeapAdapter< PairingHeap<dataType> > for a Heap<dataType>
+  **   'Priority' decides which of two elements comes first -- see Priority.hpp
+  **   a tree of any shape, where each node has a higher priority than its children:
+  **     - push() melds the new node with the root: O(1)
+  **     - pop() melds the children of the root two by two, then all the pairs into one tree: O(log n) amortized
+  **     - a higher priority cuts the node with its subtree and melds it with the root: O(1)
+  **       (amortized, and in practice -- the proven bound is o(log n))
+  **   so it suits the graph algorithms, where most of the priorityChange() calls are decrease-keys
+  **   the nodes live in a Slab of the heap, as in LinkHeap, and keep their element for life
+  **   merge() of two heaps with the same Priority melds the two roots: one comparison, once the slab of the other
+  **   heap has joined ours and its links have been shifted to their new indices, in O(m) -- its handles stay valid
+  **
+  **   priorityChange( Handle&, const dataType& ) knows whether the priority went up or down, and takes the O(1) path
+  **   when it went up; priorityChange( Handle& ) does not, so it always takes the node out and melds it back in
+  **/
+template<typename dataType, typename Priority = RuntimePriority<dataType>, typename Hooks = NoHooks >
+class PairingHeap: public StaticHeap< PairingHeap<dataType, Priority, Hooks>, dataType >
+{
+ private:
+  typedef StaticHeap< PairingHeap<dataType, Priority, Hooks>, dataType > Base ;
+  friend class StaticHeap< PairingHeap<dataType, Priority, Hooks>, dataType > ;
+
+  /***
+    ** PairNode subclass of Heap<dataType>::Handle
+    **
+    **   the children of a node are a list of siblings, starting from its first child
+    **   the links are slab indices, 0 for none -- see node() and ref()
+    **/
+  class PairNode: public Heap<dataType>::Handle
+  {
+   public:
+    // the first child, the next sibling
+    unsigned int child;
+    unsigned int next;
+
+    // the previous sibling -- or the parent, for a first child
+    unsigned int prev;
+
+    // the slab index of the node itself
+    unsigned int self;
+
+    // CONSTRUCTOR: the element is built in place from the arguments
+    template<typename... Args>
+    PairNode( unsigned int i, long id, Args&&... args )
+              : Heap<dataType>::Handle( typename Heap<dataType>::InPlace(), id, std::forward<Args>(args)... ),
+                child( 0 ), next( 0 ), prev( 0 ), self( i ) {}
+
+  };
+  /* inner class PairingHeap::PairNode */
+
+  // which of two elements comes first
+  Priority priority ;
+
+  // told about the events of the heap -- see Hooks.hpp
+  Hooks hooks ;
+
+  // the storage of the nodes
+  Slab<PairNode> slab ;
+
+  // pointer to top element
+  PairNode* pRoot ;
+
+  // the trees melded in the first pass of combine() -- kept so that a pop does not allocate
+  std::vector<PairNode*> pairs ;
+
+  // the node with a slab index, 0 for index 0
+  PairNode* node( unsigned int i ) const { return i ? slab[i] : 0 ; }
+
+  // the slab index of a node, 0 for none
+  static unsigned int ref( const PairNode* n ) { return n ? n->self : 0 ; }
+
+  // construct a new node in the slab, with the next id
+  template<typename... Args>
+  PairNode* make( Args&&... args )
+  {
+    unsigned int i = slab.allocate();
+    return new( slab[i] ) PairNode( i, ++Base::last_id, std::forward<Args>(args)... );
+  }
+
+  // link two trees into one -- the root with the lower priority becomes the first child of the other
+  PairNode* meld( PairNode*, PairNode* );
+
+  // detach a node, with its subtree, from its parent and siblings
+  void cut( PairNode* );
+
+  // meld a list of siblings into one tree, in two passes
+  PairNode* combine( unsigned int );
+
+  // take a node out of the tree, with its children melded in its place
+  void detach( PairNode* );
+
+  // duplicate the tree of another heap -- returns the copy of its root
+  PairNode* copy( const PairingHeap<dataType, Priority, Hooks>& );
+
+  // release every node
+  void destroy();
+
+  // print a node, its subtree, and its next siblings
+  void print( ostream&, const PairNode*, int = 0 ) const ;
+
+ protected:
+
+  // see StaticHeap.hpp
+  // the primitive operations used by StaticHeap -- there are no sifts in a pairing heap:
+  // siftUp() cuts the node and melds it with the root, siftDown() takes it out of the tree and melds it back in
+  //
+  void siftUp( typename Heap<dataType>::Handle& );
+  void siftDown( typename Heap<dataType>::Handle& );
+  template<typename... Args>
+  typename Heap<dataType>::Handle& createNew( Args&&... args )
+  {
+    return *make( std::forward<Args>(args)... );
+  }
+  typename Heap<dataType>::Handle& first();
+  template<typename... Args>
+  typename Heap<dataType>::Handle& append( Args&&... args )
+  {
+    typename Heap<dataType>::Handle& h = createNew( std::forward<Args>(args)... );
+    ++Base::number_of_elements ;
+    siftUp( h );
+    return h ;
+  }
+  void heapify();
+  template<typename Take>
+  void takeAll( Take );
+
+ public:
+
+  // usual constructor and destructor business
+  PairingHeap( typename Heap<dataType>::compareFxn, typename Heap<dataType>::order );
+  explicit PairingHeap( const Priority& = Priority() );
+
+  // build the heap from all the elements of an iterator range, in O(n)
+  template<typename Iterator>
+  PairingHeap( Iterator begin, Iterator end, const Priority& p = Priority() )
+               : priority( p ), pRoot( 0 )
+  {
+    for( ; begin != end ; ++begin )
+      append( *begin );
+    hooks.created( "PairingHeap", Base::size() );
+  }
+
+  // the copy duplicates the tree directly, in O(n)
+  PairingHeap( const PairingHeap<dataType, Priority, Hooks>& );
+  PairingHeap<dataType, Priority, Hooks>& operator=( const PairingHeap<dataType, Priority, Hooks>& );
+  ~PairingHeap();
+
+  // the Hooks object, e.g. to read what it has recorded
+  Hooks& instrumentation() { return hooks ; }
+
+  // used for debugging
+  void print( ostream& ) const ;
+
+  const dataType& top() const ;
+
+  // remove the top element, or any element -- replace the ones of StaticHeap, which need a complete tree
+  void pop();
+  void erase( typename Heap<dataType>::Handle& );
+
+  // see the class comment
+  void priorityChange( typename Heap<dataType>::Handle& );
+  void priorityChange( typename Heap<dataType>::Handle&, const dataType& );
+  void merge( PairingHeap<dataType, Priority, Hooks>& );
+
+};// class PairingHeap
+
+#endif // MHS_CODEBLOCKS_CPP_HEAP_PAIRINGHEAP_HPP
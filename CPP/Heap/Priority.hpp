@@ -0,0 +1,117 @@
+/*
+ * Priority.hpp
+ *   Created on: Oct 18, 2026
+ */
+
+#ifndef MHS_CODEBLOCKS_CPP_HEAP_PRIORITY_HPP
+#define MHS_CODEBLOCKS_CPP_HEAP_PRIORITY_HPP
+
+#include <functional>
+#include "Heap.hpp"
+
+/***
+  **  PRIORITY classes
+  **
+  **    a heap subclass holds ONE Priority object and asks it which of two elements comes first
+  **
+  **    OPERATIONS:
+  **
+  **    -  bool operator()( const dataType& a, long aId, const dataType& b, long bId ) const ;
+  **         return true if element 'a' has higher priority than element 'b'
+  **         the ids are the creation order of the handles and break the ties:
+  **         with SMALLER_FIRST the older element wins, with LARGER_FIRST the newer one
+  **
+  **    -  bool operator==( const Priority& ) const ;
+  **         return true if both objects put any two elements in the same order -- e.g. before a heap
+  **         links the nodes of another one into its own, as LeftistHeap::merge() does
+  **
+  ***/
+
+/**
+  *  RuntimePriority class
+  *    - the comparison function and the order are chosen when the heap is constructed
+  *    - every comparison goes through the function pointer and checks the order
+  */
+template<typename dataType>
+class RuntimePriority
+{
+ private:
+	// the function to establish ordering
+	typename Heap<dataType>::compareFxn comparison ;
+
+	// the ordering property of the heap
+	typename Heap<dataType>::order ordering ;
+
+ public:
+	RuntimePriority( typename Heap<dataType>::compareFxn f, typename Heap<dataType>::order o )
+	                 : comparison( f ), ordering( o ) {}
+
+	bool operator()( const dataType& a, long aId, const dataType& b, long bId ) const
+	{
+		if( ordering == Heap<dataType>::SMALLER_FIRST )
+		{
+			if( comparison(b, a) )
+				return false;
+			if( comparison(a, b) )
+				return true;
+			return( aId < bId );
+		}
+		else if( ordering == Heap<dataType>::LARGER_FIRST )
+		{
+			if( comparison(a, b) )
+				return false;
+			if( comparison(b, a) )
+				return true;
+			return( aId > bId );
+		}
+		else
+			throw typename Heap<dataType>::Problem();
+	}
+
+	// the same function and the same order
+	bool operator==( const RuntimePriority<dataType>& p ) const
+	{ return comparison == p.comparison && ordering == p.ordering ; }
+};
+/* class RuntimePriority */
+
+/**
+  *  StaticPriority class
+  *    - the comparison is a functor type 'Compare' (a strict 'less than') and the order is a template argument,
+  *      so the compiler can inline the whole comparison inside siftUp() and siftDown()
+  *    - e.g. ArrayHeap< long, 2, StaticPriority<long> > or
+  *           LinkHeap< Job, StaticPriority< Job, JobLess, Heap<Job>::LARGER_FIRST > >
+  */
+template<typename dataType, typename Compare = std::less<dataType>,
+         typename Heap<dataType>::order ordering = Heap<dataType>::SMALLER_FIRST>
+class StaticPriority
+{
+ private:
+	Compare comparison ;
+
+ public:
+	StaticPriority( const Compare& c = Compare() ) : comparison( c ) {}
+
+	bool operator()( const dataType& a, long aId, const dataType& b, long bId ) const
+	{
+		if( ordering == Heap<dataType>::SMALLER_FIRST )
+		{
+			if( comparison(b, a) )
+				return false;
+			if( comparison(a, b) )
+				return true;
+			return( aId < bId );
+		}
+		if( comparison(a, b) )
+			return false;
+		if( comparison(b, a) )
+			return true;
+		return( aId > bId );
+	}
+
+	// the comparison and the order are part of the type
+	bool operator==( const StaticPriority<dataType, Compare, ordering>& ) const
+	{ return true ; }
+};
+/* class StaticPriority */
+
+#endif // MHS_CODEBLOCKS_CPP_HEAP_PRIORITY_HPP
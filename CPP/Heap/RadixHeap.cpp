@@ -0,0 +1,341 @@
+/*
+ * RadixHeap.cpp
+ *   Created on: Oct 18, 2026
+ */
+
+#include <algorithm>
+#include "RadixHeap.hpp"
+
+/*************************************
+        RadixHeap MEMBER FUNCTIONS
+    *************************************/
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+RadixHeap<dataType, KeyOf, ordering, Hooks>::RadixHeap( const KeyOf& k )
+                  : keyOf( k ), head( 0 ), occupied( 0 ), last( 0 ), cached( 0 )
+{
+  hooks.created( "RadixHeap", 0 );
+}// RadixHeap CONSTRUCTOR
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+RadixHeap<dataType, KeyOf, ordering, Hooks>::RadixHeap( const RadixHeap<dataType, KeyOf, ordering, Hooks>& hp )
+                  : Base( hp ), keyOf( hp.keyOf ), hooks( hp.hooks ), head( 0 ), occupied( 0 ), last( 0 ), cached( 0 )
+{
+  copy( hp );
+  hooks.created( "RadixHeap", Base::size() );
+
+}// RadixHeap COPY CONSTRUCTOR
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+RadixHeap<dataType, KeyOf, ordering, Hooks>::~RadixHeap()
+{
+  hooks.destroyed( "RadixHeap", Base::size() );
+  destroy();
+
+}// RadixHeap DESTRUCTOR
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+RadixHeap<dataType, KeyOf, ordering, Hooks>& RadixHeap<dataType, KeyOf, ordering, Hooks>::operator=( const RadixHeap<dataType, KeyOf, ordering, Hooks>& hp )
+{
+  if( this == &hp )
+    return *this ;
+
+  destroy();
+  Base::operator=( hp );
+  keyOf = hp.keyOf ;
+  hooks = hp.hooks ;
+
+  copy( hp );
+  return *this ;
+
+}// RadixHeap ASSIGNMENT OVERLOAD
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void RadixHeap<dataType, KeyOf, ordering, Hooks>::copy( const RadixHeap<dataType, KeyOf, ordering, Hooks>& hp )
+{
+  // same elements and ids, in the same buckets
+  for( int b = 0 ; b <= BITS ; b++ )
+    for( unsigned int j = b ? 0 : hp.head ; j < hp.buckets[b].size() ; j++ )
+    {
+      unsigned int i = slab.allocate();
+      RadixNode* n = new( slab[i] ) RadixNode( *hp.slab[ hp.buckets[b][j] ] );
+      n->self = i ;
+      n->index = buckets[b].size();
+      buckets[b].push_back( i );
+    }
+  head = 0 ;
+  occupied = hp.occupied ;
+  last = hp.last ;
+  cached = 0 ;
+
+}// copy()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void RadixHeap<dataType, KeyOf, ordering, Hooks>::destroy()
+{
+  for( int b = 0 ; b <= BITS ; b++ )
+  {
+    for( unsigned int j = b ? 0 : head ; j < buckets[b].size() ; j++ )
+      slab.release( buckets[b][j] );
+    buckets[b].clear();
+  }
+  head = 0 ;
+  occupied = 0 ;
+  cached = 0 ;
+  Base::number_of_elements = 0 ;
+
+}// destroy()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void RadixHeap<dataType, KeyOf, ordering, Hooks>::file( RadixNode* n, bool inOrder )
+{
+  int b = bucketOf( n->rank );
+  n->bucket = b ;
+  std::vector<unsigned int>& v = buckets[b] ;
+
+  // a new node has the highest id: it goes at the end of bucket 0 -- any other one is put in order,
+  // unless pop() sorts the whole bucket after
+  if( b == 0 && inOrder && v.size() > head && Base::id( *slab[ v.back() ] ) > Base::id( *n ) )
+  {
+    unsigned int j = v.size();
+    v.push_back( n->self );
+    for( ; j > head && Base::id( *slab[ v[j-1] ] ) > Base::id( *n ) ; j-- )
+    {
+      v[j] = v[j-1] ;
+      slab[ v[j] ]->index = j ;
+    }
+    v[j] = n->self ;
+    n->index = j ;
+    return ;
+  }
+
+  n->index = v.size();
+  v.push_back( n->self );
+  if( b )
+    occupied |= 1ULL << ( b - 1 );
+
+}// file()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void RadixHeap<dataType, KeyOf, ordering, Hooks>::unlink( RadixNode* n )
+{
+  int b = n->bucket ;
+  std::vector<unsigned int>& v = buckets[b] ;
+
+  if( b == 0 )
+  {
+    // keep the order of the ids: the ends are O(1), the middle moves the ones after it
+    if( n->index == head )
+      ++head ;
+    else
+    {
+      for( unsigned int j = n->index ; j + 1 < v.size() ; j++ )
+      {
+        v[j] = v[j+1] ;
+        slab[ v[j] ]->index = j ;
+      }
+      v.pop_back();
+    }
+    if( head == v.size() )
+    {
+      v.clear();
+      head = 0 ;
+    }
+    return ;
+  }
+
+  // any order: the last node of the bucket takes its place
+  unsigned int moved = v.back();
+  v[ n->index ] = moved ;
+  slab[ moved ]->index = n->index ;
+  v.pop_back();
+  if( v.empty() )
+    occupied &= ~( 1ULL << ( b - 1 ) );
+
+}// unlink()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void RadixHeap<dataType, KeyOf, ordering, Hooks>::sortEqual( unsigned int from )
+{
+  std::vector<unsigned int>& v = buckets[0] ;
+  const Slab<RadixNode>& s = slab ;
+  std::sort( v.begin() + from, v.end(),
+             [&s]( unsigned int a, unsigned int b ) { return Base::id( *s[a] ) < Base::id( *s[b] ); } );
+  for( unsigned int j = from ; j < v.size() ; j++ )
+    slab[ v[j] ]->index = j ;
+
+}// sortEqual()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+unsigned int RadixHeap<dataType, KeyOf, ordering, Hooks>::best() const
+{
+  // equal keys: the oldest first with SMALLER_FIRST, the newest with LARGER_FIRST
+  if( buckets[0].size() > head )
+    return ordering == Heap<dataType>::SMALLER_FIRST ? buckets[0][head] : buckets[0].back();
+
+  if( cached )
+    return cached ;
+
+  const std::vector<unsigned int>& v = buckets[ __builtin_ctzll( occupied ) + 1 ] ;
+  unsigned int b = v[0] ;
+  for( unsigned int j = 1 ; j < v.size() ; j++ )
+  {
+    hooks.compared();
+    if( before( slab[ v[j] ], slab[b] ) )
+      b = v[j] ;
+  }
+  cached = b ;
+  return b ;
+
+}// best()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void RadixHeap<dataType, KeyOf, ordering, Hooks>::siftUp( typename Heap<dataType>::Handle& h )
+{
+  RadixNode* n = &static_cast<RadixNode&>( h );
+  file( n );
+
+  // a new best element of the first bucket
+  if( cached && n->bucket != 0 )
+  {
+    hooks.compared();
+    if( before( n, slab[cached] ) )
+      cached = n->self ;
+  }
+}// siftUp()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+typename Heap<dataType>::Handle& RadixHeap<dataType, KeyOf, ordering, Hooks>::first()
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+  return *slab[ best() ];
+
+}// first()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void RadixHeap<dataType, KeyOf, ordering, Hooks>::pop()
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+
+  RadixNode* n = slab[ best() ];
+  int b = n->bucket ;
+  unlink( n );
+  cached = 0 ;
+
+  // a new last key: the other elements of its bucket all go down to lower buckets, those equal to it to bucket 0
+  if( b )
+  {
+    last = n->rank ;
+    spread.swap( buckets[b] );
+    occupied &= ~( 1ULL << ( b - 1 ) );
+    for( unsigned int j = 0 ; j < spread.size() ; j++ )
+      file( slab[ spread[j] ], false );
+    spread.clear();
+    sortEqual( head );
+  }
+
+  slab.release( n->self );
+  --Base::number_of_elements ;
+
+}// pop()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void RadixHeap<dataType, KeyOf, ordering, Hooks>::erase( typename Heap<dataType>::Handle& h )
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+
+  RadixNode* n = &static_cast<RadixNode&>( h );
+  unlink( n );
+  if( cached == n->self )
+    cached = 0 ;
+  slab.release( n->self );
+  --Base::number_of_elements ;
+
+}// erase()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void RadixHeap<dataType, KeyOf, ordering, Hooks>::priorityChange( typename Heap<dataType>::Handle& h )
+{
+  RadixNode* n = &static_cast<RadixNode&>( h );
+  rank_t r = rankOf( keyOf( *h ) );
+  check( r );
+
+  unlink( n );
+  n->rank = r ;
+  file( n );
+  cached = 0 ;
+
+}// priorityChange()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void RadixHeap<dataType, KeyOf, ordering, Hooks>::priorityChange( typename Heap<dataType>::Handle& h, const dataType& e )
+{
+  check( rankOf( keyOf( e ) ) );
+  Base::element( h ) = e ;
+  priorityChange( h );
+
+}// priorityChange()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void RadixHeap<dataType, KeyOf, ordering, Hooks>::merge( RadixHeap<dataType, KeyOf, ordering, Hooks>& hp )
+{
+  if( this == &hp )
+    return ;
+
+  // every key first: one that comes before our last key must not leave the heaps half merged
+  std::vector<unsigned int> moved ;
+  moved.reserve( hp.size() );
+  for( int b = 0 ; b <= BITS ; b++ )
+    for( unsigned int j = b ? 0 : hp.head ; j < hp.buckets[b].size() ; j++ )
+    {
+      check( hp.slab[ hp.buckets[b][j] ]->rank );
+      moved.push_back( hp.buckets[b][j] );
+    }
+
+  // in the order of their ids, so that the equal elements of hp keep their order, behind ours
+  const Slab<RadixNode>& s = hp.slab ;
+  std::sort( moved.begin(), moved.end(),
+             [&s]( unsigned int a, unsigned int b ) { return Base::id( *s[a] ) < Base::id( *s[b] ); } );
+  for( unsigned int j = 0 ; j < moved.size() ; j++ )
+    append( std::move( Base::element( *hp.slab[ moved[j] ] ) ) );
+
+  hp.destroy();
+
+}// merge()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+const dataType& RadixHeap<dataType, KeyOf, ordering, Hooks>::top() const
+{
+  if( Base::vide() )
+    throw typename Heap<dataType>::Problem();
+  return **slab[ best() ];
+
+}// top()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+typename RadixHeap<dataType, KeyOf, ordering, Hooks>::key RadixHeap<dataType, KeyOf, ordering, Hooks>::lastKey() const
+{
+  rank_t r = ordering == Heap<dataType>::SMALLER_FIRST ? last : rank_t( ~last );
+  if( std::is_signed<key>::value )
+    r ^= rank_t( 1 ) << ( BITS - 1 );
+  return key( r );
+
+}// lastKey()
+
+template<typename dataType, typename KeyOf, typename Heap<dataType>::order ordering, typename Hooks>
+void RadixHeap<dataType, KeyOf, ordering, Hooks>::print( ostream& os ) const
+{
+  os << "size = " << Base::size() << ", last key = " << lastKey() << endl;
+  for( int b = 0 ; b <= BITS ; b++ )
+  {
+    if( buckets[b].size() <= ( b ? 0 : head ) )
+      continue ;
+    os << "bucket " << b << ":" ;
+    for( unsigned int j = b ? 0 : head ; j < buckets[b].size() ; j++ )
+      os << "  " << **slab[ buckets[b][j] ] ;
+    os << endl;
+  }
+}// print()
@@ -0,0 +1,259 @@
+/*
+ * RadixHeap.hpp
+ *   Created on: Oct 18, 2026
+ */
+
+#ifndef MHS_CODEBLOCKS_CPP_HEAP_RADIXHEAP_HPP
+#define MHS_CODEBLOCKS_CPP_HEAP_RADIXHEAP_HPP
+
+using namespace std;
+
+#include <iostream>
+#include <vector>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include "Heap.hpp"
+#include "StaticHeap.hpp"
+#include "KeyedHeap.hpp"
+#include "Hooks.hpp"
+#include "Slab.hpp"
+
+/***
+  ** class RadixHeap - a monotone priority queue of integer keys
+  **
+  **   Subclass of StaticHeap -- use HeapAdapter< RadixHeap<dataType> > for a Heap<dataType>
+  **   'KeyOf' returns the integer key of an element -- see KeyedHeap.hpp -- and the element itself by default
+  **   MONOTONE: a key may never come before the key of the last element popped, e.g. with SMALLER_FIRST
+  **   every key pushed is >= the last one popped -- as in Dijkstra's algorithm or an event queue
+  **     - the elements are kept in buckets by the highest bit in which their key differs from the last key
+  **       popped: bucket 0 for the same key, bucket b for the keys that differ first in bit b-1
+  **     - push() and priorityChange() just put the element in its bucket: O(1), and no comparison at all
+  **     - pop() takes the best element of the first bucket that is not empty, and spreads the others of that
+  **       bucket over the lower buckets -- each element only ever goes down, so O(log C) amortized,
+  **       C being the range of the keys
+  **   equal keys are ordered by their ids, as in every other heap: bucket 0 is kept in the order of the ids
+  **   the nodes live in a Slab and never move
+  **
+  **    OPERATIONS:
+  **
+  **    -  push(), emplace(), pushMany() and priorityChange() throw an OutOfOrder -- a Problem -- for a key that
+  **       comes before the last one popped; priorityChange( Handle& ) leaves the element where it was,
+  **       priorityChange( Handle&, const dataType& ) leaves it unchanged
+  **
+  **    -  key lastKey() const ;
+  **         the key of the last element popped -- the first key allowed
+  **
+  **    -  void merge( RadixHeap& );
+  **         throws an OutOfOrder, and leaves both heaps as they were, if a key of the argument comes before the
+  **         last one popped here -- it checks them all before it moves any element
+  **/
+template<typename dataType, typename KeyOf = ElementKey<dataType>,
+         typename Heap<dataType>::order ordering = Heap<dataType>::SMALLER_FIRST, typename Hooks = NoHooks >
+class RadixHeap: public StaticHeap< RadixHeap<dataType, KeyOf, ordering, Hooks>, dataType >
+{
+ public:
+  typedef typename KeyType<dataType, KeyOf>::type key ;
+
+  static_assert( std::is_integral<key>::value, "a RadixHeap has integer keys" );
+
+ /**
+   *  OutOfOrder class
+   *    thrown for a key that comes before the last one popped
+   */
+  class OutOfOrder: public Heap<dataType>::Problem
+  {
+   public:
+    const char* what() const { return "RadixHeap: the key comes before the last one popped" ; }
+  };
+  /* inner class RadixHeap::OutOfOrder */
+
+ private:
+  typedef StaticHeap< RadixHeap<dataType, KeyOf, ordering, Hooks>, dataType > Base ;
+  friend class StaticHeap< RadixHeap<dataType, KeyOf, ordering, Hooks>, dataType > ;
+
+  // the keys as unsigned integers, in the order of the heap
+  typedef typename std::make_unsigned<key>::type rank_t ;
+  enum { BITS = 8 * sizeof(rank_t) };
+
+  /***
+    ** RadixNode subclass of Heap<dataType>::Handle
+    **/
+  class RadixNode: public Heap<dataType>::Handle
+  {
+   public:
+    // the key, as rankOf() gives it
+    rank_t rank;
+
+    // the slab index of the node itself
+    unsigned int self;
+
+    // its bucket, and its position in it
+    int bucket;
+    unsigned int index;
+
+    // CONSTRUCTOR: the element is built in place from the arguments
+    template<typename... Args>
+    RadixNode( unsigned int i, long id, Args&&... args )
+               : Heap<dataType>::Handle( typename Heap<dataType>::InPlace(), id, std::forward<Args>(args)... ),
+                 rank( 0 ), self( i ), bucket( 0 ), index( 0 ) {}
+
+  };
+  /* inner class RadixHeap::RadixNode */
+
+  // the key of an element
+  KeyOf keyOf ;
+
+  // told about the events of the heap -- see Hooks.hpp -- also by top(), which may look for the best element
+  mutable Hooks hooks ;
+
+  // the storage of the nodes
+  Slab<RadixNode> slab ;
+
+  // the slab indices of the nodes in each bucket -- bucket 0 in the order of the ids, from 'head'
+  std::vector<unsigned int> buckets[ BITS + 1 ] ;
+  unsigned int head ;
+
+  // bit b-1 is set if bucket b > 0 is not empty
+  unsigned long long occupied ;
+
+  // the rank of the last element popped
+  rank_t last ;
+
+  // the node of the top element when it is not in bucket 0, 0 if not known yet -- see best()
+  mutable unsigned int cached ;
+
+  // the nodes of the bucket being spread by pop()
+  std::vector<unsigned int> spread ;
+
+  // the key of an element as an unsigned integer, smallest first whatever the order of the heap
+  static rank_t rankOf( const key& k )
+  {
+    rank_t r = rank_t( k );
+    if( std::is_signed<key>::value )
+      r ^= rank_t( 1 ) << ( BITS - 1 );
+    return ordering == Heap<dataType>::SMALLER_FIRST ? r : rank_t( ~r );
+  }
+
+  // the bucket of a rank
+  int bucketOf( rank_t r ) const
+  {
+    unsigned long long x = r ^ last ;
+    return x ? 64 - __builtin_clzll( x ) : 0 ;
+  }
+
+  // true if node a comes before node b
+  bool before( const RadixNode* a, const RadixNode* b ) const
+  {
+    if( a->rank != b->rank )
+      return a->rank < b->rank ;
+    return ordering == Heap<dataType>::SMALLER_FIRST ? Base::id( *a ) < Base::id( *b )
+                                                     : Base::id( *a ) > Base::id( *b );
+  }
+
+  // the node of the top element -- the heap is not empty
+  unsigned int best() const ;
+
+  // put a node in the bucket of its rank -- in the order of the ids for bucket 0 -- or take it out of its bucket
+  void file( RadixNode*, bool inOrder = true );
+  void unlink( RadixNode* );
+
+  // put the elements of bucket 0 from position 'from' in the order of their ids
+  void sortEqual( unsigned int from );
+
+  // throw an OutOfOrder if a key comes before the last one popped
+  void check( rank_t r ) const
+  {
+    if( r < last )
+      throw OutOfOrder();
+  }
+
+  // construct a new node in the slab, with the next id
+  template<typename... Args>
+  RadixNode* make( Args&&... args )
+  {
+    unsigned int i = slab.allocate();
+    RadixNode* n = new( slab[i] ) RadixNode( i, ++Base::last_id, std::forward<Args>(args)... );
+    n->rank = rankOf( keyOf( **n ) );
+    if( n->rank < last )
+    {
+      slab.release( i );
+      --Base::last_id ;
+      throw OutOfOrder();
+    }
+    return n ;
+  }
+
+  // duplicate the buckets of another heap
+  void copy( const RadixHeap<dataType, KeyOf, ordering, Hooks>& );
+
+  // release every node
+  void destroy();
+
+ protected:
+
+  // see StaticHeap.hpp
+  // the primitive operations used by StaticHeap -- there are no sifts in a radix heap:
+  // siftUp() puts a new node in its bucket, and pop(), erase() and priorityChange() are its own
+  //
+  void siftUp( typename Heap<dataType>::Handle& );
+  template<typename... Args>
+  typename Heap<dataType>::Handle& createNew( Args&&... args )
+  {
+    return *make( std::forward<Args>(args)... );
+  }
+  typename Heap<dataType>::Handle& first();
+  template<typename... Args>
+  typename Heap<dataType>::Handle& append( Args&&... args )
+  {
+    typename Heap<dataType>::Handle& h = createNew( std::forward<Args>(args)... );
+    ++Base::number_of_elements ;
+    siftUp( h );
+    return h ;
+  }
+  void heapify() {}
+
+ public:
+
+  // usual constructor and destructor business
+  explicit RadixHeap( const KeyOf& = KeyOf() );
+
+  // build the heap from all the elements of an iterator range, in O(n)
+  template<typename Iterator>
+  RadixHeap( Iterator begin, Iterator end, const KeyOf& k = KeyOf() )
+             : keyOf( k ), head( 0 ), occupied( 0 ), last( 0 ), cached( 0 )
+  {
+    for( ; begin != end ; ++begin )
+      append( *begin );
+    hooks.created( "RadixHeap", Base::size() );
+  }
+
+  RadixHeap( const RadixHeap<dataType, KeyOf, ordering, Hooks>& );
+  RadixHeap<dataType, KeyOf, ordering, Hooks>& operator=( const RadixHeap<dataType, KeyOf, ordering, Hooks>& );
+  ~RadixHeap();
+
+  // the Hooks object, e.g. to read what it has recorded
+  Hooks& instrumentation() { return hooks ; }
+
+  // used for debugging
+  void print( ostream& ) const ;
+
+  const dataType& top() const ;
+
+  // see the class comment
+  key lastKey() const ;
+
+  // remove the top element, or any element -- replace the ones of StaticHeap, which need a complete tree
+  void pop();
+  void erase( typename Heap<dataType>::Handle& );
+
+  // move the element to the bucket of its new key -- see the class comment
+  void priorityChange( typename Heap<dataType>::Handle& );
+  void priorityChange( typename Heap<dataType>::Handle&, const dataType& );
+
+  // move all the elements of another heap into this one -- see the class comment
+  void merge( RadixHeap<dataType, KeyOf, ordering, Hooks>& );
+
+};// class RadixHeap
+
+#endif // MHS_CODEBLOCKS_CPP_HEAP_RADIXHEAP_HPP
@@ -0,0 +1,265 @@
+/*
+ * Select.hpp
+ *   Created on: Oct 18, 2026
+ */
+
+#ifndef MHS_CODEBLOCKS_CPP_HEAP_SELECT_HPP
+#define MHS_CODEBLOCKS_CPP_HEAP_SELECT_HPP
+
+#include <type_traits>
+#include "Heap.hpp"
+
+// the SSE4 and AVX2 child selections are compiled in on x86 with gcc or clang, and used if the CPU has them
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#define MHS_HEAP_VECTORS 1
+#include <immintrin.h>
+
+// a sift that uses SSE4 or AVX2 is compiled for it, and everything it calls -- best() included -- is inlined into it
+#define MHS_SSE4 __attribute__(( target("sse4.2"), flatten ))
+#define MHS_SSE4_LANES __attribute__(( target("sse4.2") ))
+#define MHS_SSE4_INLINE __attribute__(( target("sse4.2"), always_inline ))
+#define MHS_AVX2 __attribute__(( target("avx2"), flatten ))
+#define MHS_AVX2_LANES __attribute__(( target("avx2") ))
+#define MHS_AVX2_INLINE __attribute__(( target("avx2"), always_inline ))
+#endif
+
+/***
+  **  SELECT classes
+  **
+  **    a KeyedHeap asks its Select which of the 'arity' children of a node have the best key, when they are
+  **    all there -- with a plain loop over the keys otherwise, or if the CPU cannot do better
+  **    the keys of a group of children start at a multiple of 'arity' keys in an array aligned to 64 bytes,
+  **    so every vector of a group is aligned to its width: a group of 16, 32 or 64 bytes is in one cache line,
+  **    a group of 48 or 80 bytes may be in two
+  **
+  **    OPERATIONS:
+  **
+  **    -  static SelectTier tier( int arity );
+  **         the widest instructions this CPU can pick the best of 'arity' keys with -- SCALAR_TIER for none
+  **
+  **    -  template<SelectTier> struct Lanes ;
+  **         the selection with those instructions:
+  **           enum { VECTOR };  0 for the plain loop
+  **           static unsigned int best( const key* k, int count );
+  **             the keys equal to the best of k[0] .. k[count-1], as a bit mask -- the heap breaks the ties
+  **             so 'count' is at most 32, and tier() is SCALAR_TIER for more children than that
+  **             k is aligned to the width of the vectors, and 'count' keys are a whole number of them
+  **
+  ***/
+
+// the instructions a Select may pick the children with, from none to the widest
+enum SelectTier { SCALAR_TIER, SSE4_TIER, AVX2_TIER };
+
+// the plain loop of the heap, for any tier a Select cannot do
+struct NoLanes
+{
+	enum { VECTOR = 0 };
+
+	template<typename key>
+	static unsigned int best( const key*, int ) { return 0 ; }
+};
+
+/**
+  *  ScalarSelect class
+  *    - the default of a KeyedHeap: always the plain loop, for keys of any type and any Priority
+  */
+class ScalarSelect
+{
+ public:
+	static SelectTier tier( int ) { return SCALAR_TIER ; }
+
+	template<SelectTier> struct Lanes : NoLanes {};
+};
+/* class ScalarSelect */
+
+#ifdef MHS_HEAP_VECTORS
+
+// the SSE4 selection, the same as the AVX2 one below with 16-byte vectors -- for the CPUs without AVX2, and the
+// groups of 48 or 80 bytes: SSE4.1 has the min/max of 4-byte integers, SSE4.2 the compare of 8-byte ones
+template<typename key, typename Heap<key>::order ordering, int bytes = sizeof(key)>
+struct Sse4Lanes : NoLanes {};
+
+template<typename key, typename Heap<key>::order ordering>
+struct Sse4Lanes<key, ordering, 4>
+{
+	enum { VECTOR = 1 };
+
+	MHS_SSE4_INLINE static __m128i better( __m128i a, __m128i b )
+	{
+		if( ordering == Heap<key>::SMALLER_FIRST )
+		  return std::is_signed<key>::value ? _mm_min_epi32( a, b ) : _mm_min_epu32( a, b );
+		return std::is_signed<key>::value ? _mm_max_epi32( a, b ) : _mm_max_epu32( a, b );
+	}
+
+	MHS_SSE4_LANES static unsigned int best( const key* k, int count )
+	{
+		__m128i m = _mm_load_si128( (const __m128i*)k );
+		for( int i = 4 ; i < count ; i += 4 )
+		  m = better( m, _mm_load_si128( (const __m128i*)(k + i) ) );
+		m = better( m, _mm_shuffle_epi32( m, 0x4E ) );
+		m = better( m, _mm_shuffle_epi32( m, 0xB1 ) );
+
+		unsigned int mask = 0 ;
+		for( int i = 0 ; i < count ; i += 4 )
+		  mask |= unsigned( _mm_movemask_ps( _mm_castsi128_ps(
+		                      _mm_cmpeq_epi32( _mm_load_si128( (const __m128i*)(k + i) ), m ) ) ) ) << i ;
+		return mask ;
+	}
+};
+
+template<typename key, typename Heap<key>::order ordering>
+struct Sse4Lanes<key, ordering, 8>
+{
+	enum { VECTOR = 1 };
+
+	// a > b, signed -- unsigned keys are shifted by 2^63 first
+	MHS_SSE4_INLINE static __m128i greater( __m128i a, __m128i b )
+	{
+		if( !std::is_signed<key>::value )
+		{
+			const __m128i bias = _mm_set1_epi64x( (long long)( 1ULL << 63 ) );
+			a = _mm_xor_si128( a, bias );
+			b = _mm_xor_si128( b, bias );
+		}
+		return _mm_cmpgt_epi64( a, b );
+	}
+
+	MHS_SSE4_INLINE static __m128i better( __m128i a, __m128i b )
+	{
+		if( ordering == Heap<key>::SMALLER_FIRST )
+		  return _mm_blendv_epi8( a, b, greater(a, b) );
+		return _mm_blendv_epi8( a, b, greater(b, a) );
+	}
+
+	MHS_SSE4_LANES static unsigned int best( const key* k, int count )
+	{
+		__m128i m = _mm_load_si128( (const __m128i*)k );
+		for( int i = 2 ; i < count ; i += 2 )
+		  m = better( m, _mm_load_si128( (const __m128i*)(k + i) ) );
+		m = better( m, _mm_shuffle_epi32( m, 0x4E ) );
+
+		unsigned int mask = 0 ;
+		for( int i = 0 ; i < count ; i += 2 )
+		  mask |= unsigned( _mm_movemask_pd( _mm_castsi128_pd(
+		                      _mm_cmpeq_epi64( _mm_load_si128( (const __m128i*)(k + i) ), m ) ) ) ) << i ;
+		return mask ;
+	}
+};
+
+// the AVX2 selection: the best key is spread to every lane of one vector, which is then compared with all the keys
+// again -- only for 4- and 8-byte integers, and 'count' keys that are a whole number of 32-byte vectors
+template<typename key, typename Heap<key>::order ordering, int bytes = sizeof(key)>
+struct Avx2Lanes : NoLanes {};
+
+template<typename key, typename Heap<key>::order ordering>
+struct Avx2Lanes<key, ordering, 4>
+{
+	enum { VECTOR = 1 };
+
+	MHS_AVX2_INLINE static __m256i better( __m256i a, __m256i b )
+	{
+		if( ordering == Heap<key>::SMALLER_FIRST )
+		  return std::is_signed<key>::value ? _mm256_min_epi32( a, b ) : _mm256_min_epu32( a, b );
+		return std::is_signed<key>::value ? _mm256_max_epi32( a, b ) : _mm256_max_epu32( a, b );
+	}
+
+	MHS_AVX2_LANES static unsigned int best( const key* k, int count )
+	{
+		__m256i m = _mm256_load_si256( (const __m256i*)k );
+		for( int i = 8 ; i < count ; i += 8 )
+		  m = better( m, _mm256_load_si256( (const __m256i*)(k + i) ) );
+		m = better( m, _mm256_permute2x128_si256( m, m, 1 ) );
+		m = better( m, _mm256_shuffle_epi32( m, 0x4E ) );
+		m = better( m, _mm256_shuffle_epi32( m, 0xB1 ) );
+
+		unsigned int mask = 0 ;
+		for( int i = 0 ; i < count ; i += 8 )
+		  mask |= unsigned( _mm256_movemask_ps( _mm256_castsi256_ps(
+		                      _mm256_cmpeq_epi32( _mm256_load_si256( (const __m256i*)(k + i) ), m ) ) ) ) << i ;
+		return mask ;
+	}
+};
+
+template<typename key, typename Heap<key>::order ordering>
+struct Avx2Lanes<key, ordering, 8>
+{
+	enum { VECTOR = 1 };
+
+	// a > b -- AVX2 only compares signed 64-bit integers, so unsigned ones are shifted by 2^63 first
+	MHS_AVX2_INLINE static __m256i greater( __m256i a, __m256i b )
+	{
+		if( !std::is_signed<key>::value )
+		{
+			const __m256i bias = _mm256_set1_epi64x( (long long)( 1ULL << 63 ) );
+			a = _mm256_xor_si256( a, bias );
+			b = _mm256_xor_si256( b, bias );
+		}
+		return _mm256_cmpgt_epi64( a, b );
+	}
+
+	MHS_AVX2_INLINE static __m256i better( __m256i a, __m256i b )
+	{
+		if( ordering == Heap<key>::SMALLER_FIRST )
+		  return _mm256_blendv_epi8( a, b, greater(a, b) );
+		return _mm256_blendv_epi8( a, b, greater(b, a) );
+	}
+
+	MHS_AVX2_LANES static unsigned int best( const key* k, int count )
+	{
+		__m256i m = _mm256_load_si256( (const __m256i*)k );
+		for( int i = 4 ; i < count ; i += 4 )
+		  m = better( m, _mm256_load_si256( (const __m256i*)(k + i) ) );
+		m = better( m, _mm256_permute2x128_si256( m, m, 1 ) );
+		m = better( m, _mm256_shuffle_epi32( m, 0x4E ) );
+
+		unsigned int mask = 0 ;
+		for( int i = 0 ; i < count ; i += 4 )
+		  mask |= unsigned( _mm256_movemask_pd( _mm256_castsi256_pd(
+		                      _mm256_cmpeq_epi64( _mm256_load_si256( (const __m256i*)(k + i) ), m ) ) ) ) << i ;
+		return mask ;
+	}
+};
+#endif // MHS_HEAP_VECTORS
+
+/**
+  *  VectorSelect class
+  *    - integer keys in the order of std::less<key> and 'ordering' -- the Priority of the heap must agree,
+  *      as StaticPriority< key, std::less<key>, ordering > does
+  *    - AVX2 when the CPU has it and the children fill whole 32-byte vectors (e.g. 8 ints or 4 longs),
+  *      else SSE4 when they fill two or more whole 16-byte ones (e.g. 12 ints or 6 longs), else the plain loop
+  *    - not one 16-byte vector alone (4 ints or 2 longs): its mask and its ties cost more than the plain loop,
+  *      which the CPU can run ahead of, spends on a few compares
+  *    - and not more than 32 children, which do not fit in the mask of best()
+  *    - e.g. KeyedHeap< Job, JobKey, 8, StaticPriority<long>, NoHooks, VectorSelect<long> >
+  */
+template<typename key, typename Heap<key>::order ordering = Heap<key>::SMALLER_FIRST>
+class VectorSelect
+{
+	static_assert( std::is_integral<key>::value, "a VectorSelect compares integer keys" );
+
+ public:
+	static SelectTier tier( int arity )
+	{
+#ifdef MHS_HEAP_VECTORS
+		if( arity > 32 )
+		  return SCALAR_TIER ;
+		if( Avx2Lanes<key, ordering>::VECTOR && ( arity * sizeof(key) ) % 32 == 0 && __builtin_cpu_supports( "avx2" ) )
+		  return AVX2_TIER ;
+		if( Sse4Lanes<key, ordering>::VECTOR && ( arity * sizeof(key) ) % 16 == 0 && arity * sizeof(key) >= 32
+		    && __builtin_cpu_supports( "sse4.2" ) )
+		  return SSE4_TIER ;
+#endif
+		return SCALAR_TIER ;
+	}
+
+#ifdef MHS_HEAP_VECTORS
+	template<SelectTier tier>
+	struct Lanes : std::conditional< tier == AVX2_TIER, Avx2Lanes<key, ordering>,
+	               typename std::conditional< tier == SSE4_TIER, Sse4Lanes<key, ordering>, NoLanes >::type >::type {};
+#else
+	template<SelectTier> struct Lanes : NoLanes {};
+#endif
+};
+/* class VectorSelect */
+
+#endif // MHS_CODEBLOCKS_CPP_HEAP_SELECT_HPP
@@ -0,0 +1,78 @@
+/*
+ * Slab.cpp
+ *   Created on: Oct 18, 2026
+ */
+
+#include <new>
+#include "Slab.hpp"
+
+// CONSTRUCTOR: no chunk until the first allocate() -- slot 0 is reserved
+template<typename T>
+Slab<T>::Slab() : top( 1 ), free( 0 ) { }
+
+// DESTRUCTOR
+template<typename T>
+Slab<T>::~Slab()
+{
+	for( unsigned int c = 0 ; c < chunks.size() ; c++ )
+	  ::operator delete( chunks[c] );
+}
+
+// allocate(): reuse the last released slot, or take the next new one -- adding a chunk when they are all used
+template<typename T>
+unsigned int Slab<T>::allocate()
+{
+	if( free )
+	{
+		unsigned int i = free ;
+		free = *reinterpret_cast<unsigned int*>( (*this)[i] );
+		return i ;
+	}
+
+	unsigned int i = top++ ;
+	if( (i >> SLAB_CHUNK_BITS) == chunks.size() )
+	  chunks.push_back( static_cast<T*>(::operator new( (1u << SLAB_CHUNK_BITS) * sizeof(T) )) );
+	return i ;
+}
+
+// release(): the index of the next free slot is stored in the slot itself
+template<typename T>
+void Slab<T>::release( unsigned int i )
+{
+	T* slot = (*this)[i] ;
+	slot->~T();
+	new( slot ) unsigned int( free );
+	free = i ;
+}
+
+// adopt(): the chunks of the other slab go after ours -- the slots of our last chunk that were never used
+// go on the free list, so that 'top' can move on into the other chunks, and so does its free list, shifted
+template<typename T>
+unsigned int Slab<T>::adopt( Slab<T>& other )
+{
+	unsigned int offset = chunks.size() << SLAB_CHUNK_BITS ;
+	if( other.chunks.empty() )
+	  return offset ;
+
+	for( ; top < offset ; top++ )
+	{
+		new( (*this)[top] ) unsigned int( free );
+		free = top ;
+	}
+	for( unsigned int i = other.free ; i ; )
+	{
+		unsigned int* slot = reinterpret_cast<unsigned int*>( other[i] );
+		i = *slot ;
+		*slot = i ? i + offset : free ;
+	}
+	if( other.free )
+	  free = other.free + offset ;
+
+	chunks.insert( chunks.end(), other.chunks.begin(), other.chunks.end() );
+	top = offset + other.top ;
+
+	other.chunks.clear();
+	other.top = 1 ;
+	other.free = 0 ;
+	return offset ;
+}
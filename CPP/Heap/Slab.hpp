@@ -0,0 +1,75 @@
+/*
+ * Slab.hpp
+ *   Created on: Oct 18, 2026
+ */
+
+#ifndef MHS_CODEBLOCKS_CPP_HEAP_SLAB_HPP
+#define MHS_CODEBLOCKS_CPP_HEAP_SLAB_HPP
+
+#include <vector>
+
+// the number of slots in a chunk of a slab, as a power of 2
+const int SLAB_CHUNK_BITS = 10 ;
+
+/***
+  **  Slab class
+  **
+  **    - the storage of the nodes of ONE heap: the slots are numbered with 32-bit indices,
+  **      so a node can link to another in 4 bytes instead of an 8-byte pointer
+  **    - the slots live in chunks of 2^SLAB_CHUNK_BITS slots that are never moved,
+  **      so a node keeps its address -- and its handle stays valid -- while the slab grows,
+  **      and finding a slot is just a shift and a mask
+  **    - a released slot goes on a free list threaded through the slots themselves,
+  **      so after the first chunks are allocated, creating a node costs no malloc
+  **    - index 0 is never handed out: it stands for 'no node'
+  **
+  **    OPERATIONS:
+  **
+  **    -  unsigned int allocate();
+  **         the index of a free slot -- the caller constructs the object in it with placement new
+  **
+  **    -  void release( unsigned int );
+  **         destroy the object in the slot and put the slot on the free list
+  **
+  **    -  T* operator[]( unsigned int ) const ;
+  **         the slot with that index -- the caller checks for index 0
+  **
+  **    -  unsigned int adopt( Slab& );
+  **         take over all the chunks of another slab, which is left empty -- the objects in them do not move,
+  **         and the one in its slot i is now in slot i plus the returned offset
+  **
+  ***/
+template<typename T>
+class Slab
+{
+ private:
+	// the chunks of slots
+	std::vector<T*> chunks ;
+
+	// the next slot that was never used
+	unsigned int top ;
+
+	// the first slot of the free list, 0 if it is empty
+	unsigned int free ;
+
+	// the slab owns its chunks
+	Slab( const Slab<T>& );
+	Slab<T>& operator=( const Slab<T>& );
+
+ public:
+	Slab();
+
+	// only gives back the chunks -- the owner destroys the objects still in them
+	~Slab();
+
+	unsigned int allocate();
+	void release( unsigned int );
+	unsigned int adopt( Slab<T>& );
+
+	// the chunk is the high bits of the index, the slot in it the low bits
+	T* operator[]( unsigned int i ) const
+	{ return chunks[ i >> SLAB_CHUNK_BITS ] + ( i & ((1u << SLAB_CHUNK_BITS) - 1) ); }
+
+};// class Slab
+
+#endif // MHS_CODEBLOCKS_CPP_HEAP_SLAB_HPP
@@ -0,0 +1,138 @@
+/*
+ * StaticHeap.cpp
+ *   Created on: Oct 18, 2026
+ */
+
+#include "StaticHeap.hpp"
+
+// CONSTRUCTOR
+template<typename Derived, typename dataType>
+StaticHeap<Derived, dataType>::StaticHeap()
+{
+	number_of_elements = 0 ;
+	last_id = 0 ;
+}
+
+// push()
+// most probably does not have to be overloaded in the subclass
+// IMPORTANT: emplace() increments the number of elements so createNew() shouldn't !!!
+template<typename Derived, typename dataType>
+typename StaticHeap<Derived, dataType>::Handle& StaticHeap<Derived, dataType>::push( const dataType& ex )
+{
+  /* the subclasses move nodes around rather than the elements inside them,
+   * so the handle returned is still the handle of the value just pushed onto the heap */
+  return emplace( ex );
+}
+
+// push(): same, but the element is moved into its node instead of copied
+template<typename Derived, typename dataType>
+typename StaticHeap<Derived, dataType>::Handle& StaticHeap<Derived, dataType>::push( dataType&& ex )
+{
+  return emplace( std::move(ex) );
+}
+
+// priorityChange()
+// notify the heap that the element with handle h may have had its priority changed!
+template<typename Derived, typename dataType>
+void StaticHeap<Derived, dataType>::priorityChange( Handle& h )
+{
+	derived().siftUp( h );   // does nothing if priority is lower
+	derived().siftDown( h ); // does nothing if priority is higher
+}
+
+// priorityChange()
+// same, but the heap itself stores the new value -- no const_cast on *h needed
+template<typename Derived, typename dataType>
+void StaticHeap<Derived, dataType>::priorityChange( Handle& h, const dataType& e )
+{
+	element( h ) = e ;
+	derived().priorityChange( h );
+}
+
+// pop()
+// most probably does not have to be overloaded in the subclass
+// IMPORTANT: decrements the number of elements so deleteLast() shouldn't !!!
+template<typename Derived, typename dataType>
+void StaticHeap<Derived, dataType>::pop()
+{
+	if( vide() )
+	  throw Problem();
+
+	derived().moveLastToFirst();
+	derived().deleteLast();
+	--number_of_elements ;
+
+	if( !vide() )
+	  derived().siftDown( derived().first() );
+}
+
+// erase()
+// IMPORTANT: decrements the number of elements so deleteLast() shouldn't !!!
+template<typename Derived, typename dataType>
+void StaticHeap<Derived, dataType>::erase( Handle& h )
+{
+	if( vide() )
+	  throw Problem();
+
+	Handle& moved = derived().moveLastTo( h );
+	derived().deleteLast();
+	--number_of_elements ;
+
+	// the element that was last may belong above or below its new position -- unless h was the last one
+	if( &moved != &h )
+	{
+		derived().siftUp( moved );
+		derived().siftDown( moved );
+	}
+}
+
+// popValue()
+// move the top element out of its node before pop() destroys the node -- nothing compares it after that
+template<typename Derived, typename dataType>
+dataType StaticHeap<Derived, dataType>::popValue()
+{
+	if( vide() )
+	  throw Problem();
+
+	dataType top( std::move( element(derived().first()) ) );
+	derived().pop();
+	return top ;
+}
+
+// merge()
+// the elements are moved straight out of the nodes of H, which are then released -- nothing is popped:
+// O(m log n) when they are pushed one by one, O(n + m) when H is at least PUSH_MANY_FACTOR times as big as
+// this heap and they are appended and heapified, like pushMany()
+// each gets the id it had in H plus our last id, so the equal elements of H keep their order, behind ours
+template<typename Derived, typename dataType>
+void StaticHeap<Derived, dataType>::merge( Derived& H )
+{
+	if( &H == &derived() )
+	  return ;
+
+	bool batch = H.size() >= PUSH_MANY_FACTOR * size();
+	long offset = last_id ;
+	H.takeAll( [&]( Handle& h )
+	{
+		// createNew() gives the next id
+		last_id = offset + id( h ) - 1 ;
+		if( batch )
+		  derived().append( std::move(element(h)) );
+		else
+		    emplace( std::move(element(h)) );
+	} );
+	last_id = offset + H.last_id ;
+
+	if( batch )
+	  derived().heapify();
+}
+
+// empty()
+template<typename Derived, typename dataType>
+bool StaticHeap<Derived, dataType>::vide() const
+{ return number_of_elements == 0 ; }
+
+// size() - return the number of elements
+template<typename Derived, typename dataType>
+int StaticHeap<Derived, dataType>::size() const
+{ return number_of_elements ; }
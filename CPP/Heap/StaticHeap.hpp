@@ -0,0 +1,176 @@
+/*
+ * StaticHeap.hpp
+ *   Created on: Oct 18, 2026
+ */
+
+#ifndef MHS_CODEBLOCKS_CPP_HEAP_STATICHEAP_HPP
+#define MHS_CODEBLOCKS_CPP_HEAP_STATICHEAP_HPP
+
+#include <iterator>
+#include <utility>
+#include "Heap.hpp"
+
+// pushMany() and merge() append a batch and heapify only when it is at least PUSH_MANY_FACTOR times as big as the heap
+//   -- random keys sift up O(1) levels on average, so one by one is cheaper up to about that size, while a batch
+//   in reverse order, which sifts every element up to the top, is cheaper to heapify at any size
+const int PUSH_MANY_FACTOR = 4 ;
+
+/***
+  **  StaticHeap class
+  **
+  **    - the common part of every heap implementation, with the same OPERATIONS as Heap<dataType>
+  **    - 'Derived' is the implementation itself (ArrayHeap, LinkHeap, ...) which provides the
+  **      primitive operations below; they are called directly, NOT through virtual functions,
+  **      so the compiler can inline a whole push() or pop() down to the comparisons
+  **    - to use an implementation through a Heap<dataType>&, wrap it in a HeapAdapter
+  **
+  **    PRIMITIVE OPERATIONS, to be provided by Derived:
+  **
+  **    -  void siftUp( Handle& );
+  **         the 'sift up' operation, start at the argument
+  **
+  **    -  void siftDown( Handle& );
+  **         the 'sift down' operation, start at the argument
+  **
+  **    -  Handle& createNew( Args&&... );
+  **         create a new handle at the 'right' position and return its handle
+  **         the element is constructed in place from the arguments, which are perfectly forwarded,
+  **         and the handle gets the id ++last_id
+  **         the handle must keep referring to this element while siftUp()/siftDown() move it
+  **
+  **    -  Handle& first();
+  **         return the handle of the first or 'highest priority' element
+  **
+  **    -  void moveLastToFirst();
+  **         move the last element to become the first, needed for pop
+  **
+  **    -  void deleteLast();
+  **         delete the last element's handle
+  **
+  **    -  Handle& moveLastTo( Handle& );
+  **         exchange the positions of the last element and the argument, needed for erase
+  **         returns the handle of the element that was last
+  **
+  **    -  Handle& append( Args&&... );
+  **         create a new handle at the 'right' position, count it, but do NOT sift it
+  **
+  **    -  void heapify();
+  **         restore the heap order of all the elements, bottom-up in O(n)
+  **
+  **    -  void takeAll( Take );
+  **         call take( Handle& ) once on every element, in any order, then release all the handles and leave
+  **         the heap empty -- take() moves the element out, for merge()
+  **
+  **    a heap that is not a complete tree (PairingHeap) has no 'last' element: it provides its own pop()
+  **    and erase() instead of moveLastToFirst(), moveLastTo() and deleteLast(), and popValue() calls that pop()
+  **
+  ***/
+template<typename Derived, typename dataType>
+class StaticHeap
+{
+  public:
+		// the types shared by all the heaps
+		typedef dataType value_type ;
+		typedef typename Heap<dataType>::Handle Handle ;
+		typedef typename Heap<dataType>::Problem Problem ;
+
+  protected:
+    // the number of elements currently stored in the heap
+    int number_of_elements ;
+
+    // the id of the last element created -- the ids of one heap order its equal elements
+    long last_id ;
+
+		// the implementation
+		Derived& derived() { return static_cast<Derived&>( *this ); }
+
+		// only the implementations are constructed
+		StaticHeap();
+
+		// the element stored in a handle, for the implementations to move it out
+		static dataType& element( Handle& h ) { return h.elem ; }
+
+		// add to the id of a handle -- for the nodes that an implementation takes over from another heap in merge()
+		static void renumber( Handle& h, long offset ) { h.id += offset ; }
+
+		// the id of a handle -- for the implementations that keep the ids next to the keys
+		static long id( const Handle& h ) { return h.id ; }
+
+  public:
+		// HEAP INTERFACE -- top() is provided by Derived
+
+		// remove the highest priority element
+		void pop();
+
+		// insert a new element and return its handle
+		Handle& push( const dataType& );
+
+		// insert a new element by moving it into the heap
+		Handle& push( dataType&& );
+
+		// insert a new element constructed in place from the arguments of one of its constructors
+		template<typename... Args>
+		Handle& emplace( Args&&... args )
+		{
+			Handle& h = derived().createNew( std::forward<Args>(args)... );
+			++number_of_elements ;
+
+			derived().siftUp( h );
+			return h ;
+		}
+
+		// remove the highest priority element and return it, moved out of the heap
+		dataType popValue();
+
+		// remove the element with handle -- the last element takes its place and is sifted whichever way it needs
+		void erase( Handle& );
+
+		// change the position of the element with handle because its priority has changed
+		void priorityChange( Handle& );
+
+		// give the element with handle a new value and change its position accordingly
+		void priorityChange( Handle&, const dataType& );
+
+		// insert all the elements of a (forward iterator) range
+		//   a batch at least PUSH_MANY_FACTOR times as big as the heap is appended and heapified in O(n),
+		//   a smaller one is sifted up element by element
+		template<typename Iterator>
+		void pushMany( Iterator begin, Iterator end )
+		{
+			if( std::distance(begin, end) < PUSH_MANY_FACTOR * size() )
+			  for( ; begin != end ; ++begin )
+			    push( *begin );
+			else
+			{
+				for( ; begin != end ; ++begin )
+				  derived().append( *begin );
+				derived().heapify();
+			}
+		}
+
+		// remove the k (or all, if fewer) highest priority elements and write them to out in order
+		// returns the output iterator past the last element written
+		template<typename Output>
+		Output popMany( int k, Output out )
+		{
+			for( ; k > 0 && !vide() ; --k )
+			  *out++ = popValue();
+			return out ;
+		}
+
+		// move all the elements of another heap into this one and leave it empty
+		//   the elements are moved out of the nodes of the other heap with takeAll(), so its handles are lost --
+		//   the implementations that can take over the nodes of the other heap do it in their own merge() and keep them
+		//   O(m log n), or O(n + m) when the other heap is at least PUSH_MANY_FACTOR times as big, like pushMany()
+		//   it is for the heaps that take any element: those whose push() can refuse one (RadixHeap, BucketQueue)
+		//   have their own merge(), which checks every element before it moves any
+		void merge( Derived& );
+
+		// true iff heap is empty
+		bool vide() const ;
+
+		// number of elements in the heap
+		int size() const ;
+};
+
+#endif // MHS_CODEBLOCKS_CPP_HEAP_STATICHEAP_HPP
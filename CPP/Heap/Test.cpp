@@ -18,7 +18,6 @@ TestType::TestType( const long& v )
 {
   id = ++last_id ;
   value = v ;
-  cout << "Create a new TestType with val '" << v << "'." << endl;
 }
 
 // operator*() - return a reference (alias) to the 'value'
@@ -27,6 +26,24 @@ long& TestType::operator*()
   return value ;
 }
 
+// operator==() - compare the 'value's, not the ids
+bool TestType::operator==( const TestType& t ) const
+{
+  return value == t.value ;
+}
+
+// hash of a TestType
+size_t std::hash<TestType>::operator()( const TestType& t ) const
+{
+  return std::hash<long>()( *const_cast<TestType&>(t) );
+}
+
+// the key of a TestType is its 'value'
+long TestKey::operator()( const TestType& t ) const
+{
+  return *const_cast<TestType&>(t);
+}
+
 // print a TestType
 ostream& operator<<( ostream& os, const TestType& c )
 {
@@ -15,6 +15,7 @@
 using namespace std ;
 
 #include <iostream>
+#include <functional>
 
 class TestType 
 {
@@ -33,6 +34,9 @@ class TestType
 	// overload operator* to return 'value'
 	long& operator*();
 
+	// two TestTypes are equal if they store the same 'value'
+	bool operator==( const TestType& ) const ;
+
  // print out a TestType
  friend ostream& operator<<( ostream&, const TestType& );
 };
@@ -42,4 +46,20 @@ ostream& operator<<( ostream&, const TestType& );
 
 bool lt( const TestType&, const TestType& );
 
+// the 'value' of a TestType, as the key of a KeyedHeap
+struct TestKey
+{
+  long operator()( const TestType& ) const ;
+};
+
+// hash a TestType by its 'value', like operator==() -- needed by the index of LinkHeap
+namespace std
+{
+  template<>
+  struct hash<TestType>
+  {
+    size_t operator()( const TestType& ) const ;
+  };
+}
+
 #endif // MHS_CODEBLOCKS_CPP_HEAP_TEST_HPP